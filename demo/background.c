@@ -20,6 +20,7 @@ const vector_t MIN3 = {0, 0};
 void level_gen(scene_t *scene)
 {
     vector_t m = (vector_t) {3000, 500};
+    scene_set_bounds(scene, VEC_ZERO, m);
 
     // add_background(scene, m);
     // flor
@@ -32,44 +33,13 @@ void level_gen(scene_t *scene)
 }
 
 
-void move_camera(scene_t *scene, double x, double y)
-{
-    for (size_t role = 0; role < NUM_ROLES; role ++)
-    {
-        list_t *role_list = scene_get_list(scene, role);
-        for (int i = 0; i < list_size(role_list); i++)
-        {
-            body_t *body = (body_t*) list_get(role_list, i);
-            body_translate(body, (vector_t) {x, y});
-        }
-    }
-}
-
 void track_player(scene_t *scene)
 {
     body_t *player = scene_get_body(scene, PLAYER, 0);
-    vector_t playerPos = body_get_centroid(player);
-    list_t *platform_list = scene_get_list(scene, PLATFORM);
-    double leftBound = body_get_centroid(list_get(platform_list, 2)).x;
-    double rightBound = body_get_centroid(list_get(platform_list, 3)).x;
-    bool moved = false;
-    if (leftBound < 0 && playerPos.x < 250) {
-        move_camera(scene, 250 - playerPos.x, 0);
-    }
-    if (rightBound > 1000 && playerPos.x > 750) {
-        move_camera(scene, 750 - playerPos.x, 0);
-    }
-    /*// try to avoid calling same function again*/
-    /*// leftBound = body_get_centroid(list_get(scene_get_list(scene, PLATFORM), 2)).x;*/
-    /*// rightBound = body_get_centroid(list_get(scene_get_list(scene, PLATFORM), 3)).x;*/
-    if (leftBound > 0)
-    {
-        move_camera(scene, 0 - leftBound, 0);
-    }
-    if (rightBound < 1000)
-    {
-        move_camera(scene, 1000 - rightBound, 0);
-    }
+    double leftBound = scene_get_min(scene).x;
+    double rightBound = scene_get_max(scene).x;
+    sdl_camera_set_bounds((vector_t) {leftBound, MIN3.y}, (vector_t) {rightBound, MAX3.y});
+    sdl_camera_follow(body_get_interpolated_centroid(player, scene_get_alpha(scene)));
 }
 // Game loop ------------------------------------------------------------------
 
@@ -99,10 +69,11 @@ int main()
         sdl_render_scene(scene);
         sdl_render();
         // move_window(-1, 0);
-        scene_tick(scene, time_since_last_tick());
+        scene_advance(scene, time_since_last_tick());
         track_player(scene);
     }
 
     // Free the scene!
     scene_free(scene);
+    shape_templates_free();
 }
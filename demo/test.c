@@ -23,34 +23,16 @@ int player_choice = -1;
 const double LEADERBOARD = 0;
 const double LEVELS = 1;
 
-// Translates every object in scene
-void move_camera(scene_t *scene, double x, double y)
-{
-    // Starts at 1 because you don't move background
-    for (size_t role = 0; role < NUM_ROLES; role ++)
-    {
-        list_t *role_list = scene_get_list(scene, role);
-        for (int i = 0; i < list_size(role_list); i++)
-        {
-            body_t *body = (body_t*) list_get(role_list, i);
-            body_translate(body, (vector_t) {x, y});
-        }
-    }
-}
-// Tracks player movement by translating entire scene
+// Follows player 1 with the camera, keeping the view between the side walls
 void track_player(scene_t *scene)
 {
     body_t *player = scene_get_body(scene, PLAYER, 0);
-    vector_t playerPos = body_get_centroid(player);
-    list_t *platform_list = scene_get_list(scene, PLATFORM);
-    double leftBound = body_get_centroid(list_get(platform_list, 2)).x;
-    double rightBound = body_get_centroid(list_get(platform_list, 3)).x;
-    // Only translates scene when player is not b/w 250-750(x-axis) of shown screen
-    if (leftBound < 0 && playerPos.x < 250) {move_camera(scene, 250 - playerPos.x, 0);}
-    if (rightBound > 1000 && playerPos.x > 750) {move_camera(scene, 750 - playerPos.x, 0);}
-    // Handles edge case so that camera stops at border and doesn't go off screen
-    if (leftBound > 0) {move_camera(scene, 0 - leftBound, 0);}
-    if (rightBound < 1000) {move_camera(scene, 1000 - rightBound, 0);}
+    double leftBound = scene_get_min(scene).x;
+    double rightBound = scene_get_max(scene).x;
+    // Only scrolls when player leaves 250-750(x-axis) of shown screen, and
+    // stops at the borders so it doesn't go off screen
+    sdl_camera_set_bounds((vector_t) {leftBound, MIN.y}, (vector_t) {rightBound, MAX.y});
+    sdl_camera_follow(body_get_interpolated_centroid(player, scene_get_alpha(scene)));
 }
 
 // updates entry fields
@@ -74,7 +56,8 @@ bool game_is_over(scene_t* scene, bool* victory, entry_t* entry1, entry_t* entry
         sprite_t* player2 = (sprite_t*) body_get_info(body_player2);
         game_entry_update(player, entry1);
         game_entry_update(player2, entry2);
-        if (body_get_centroid(body_player).x + END_DISTANCE >= body_get_centroid(scene_get_body(scene, PLATFORM, 3)).x || body_get_centroid(body_player2).x + END_DISTANCE >= body_get_centroid(scene_get_body(scene, PLATFORM, 3)).x)
+        double end = scene_get_max(scene).x;
+        if (body_get_centroid(body_player).x + END_DISTANCE >= end || body_get_centroid(body_player2).x + END_DISTANCE >= end)
         {
             // Updates entry
             *victory = true;
@@ -89,7 +72,7 @@ bool game_is_over(scene_t* scene, bool* victory, entry_t* entry1, entry_t* entry
     {
         game_entry_update(player, entry1);
         // Player is w/in 50 pixels of end level, so they won
-        if (body_get_centroid(body_player).x + END_DISTANCE >= MAX.x)
+        if (body_get_centroid(body_player).x + END_DISTANCE >= scene_get_max(scene).x)
         {
             *victory = true;
             return true;
@@ -120,6 +103,7 @@ void run_sublevel(bool multiplayer, entry_t* entry_player1, entry_t* entry_playe
     bool victory = false;
     *sublevel = true;
     update_players(scene, scene2, multiplayer); // updates players in scene 2
+    sdl_camera_reset();
     sdl_clear();
     while(player_choice >= LEVELS && !game_is_over(scene2, &victory, entry_player1, entry_player2, multiplayer) && menu_choice() != QUIT_VALUE)
     {
@@ -128,7 +112,7 @@ void run_sublevel(bool multiplayer, entry_t* entry_player1, entry_t* entry_playe
         if (multiplayer) {sdl_on_key((key_handler_t) multiplayer_on_key);}
         else {sdl_on_key((key_handler_t) on_key);}
         double dt = time_since_last_tick();
-        scene_tick(scene2, dt);
+        scene_advance(scene2, dt);
         sdl_render_scene(scene2);
         text_level_info(scene2, multiplayer);
         sdl_render();
@@ -152,7 +136,7 @@ void run_sublevel(bool multiplayer, entry_t* entry_player1, entry_t* entry_playe
                 body_set_centroid(player2, v1) : body_set_centroid(player, v2); 
         }
     }
-    free(scene2);
+    scene_free(scene2);
 }
 
 
@@ -209,10 +193,11 @@ int main()
         if (player_choice == LEVEL_1) {opening_story();}
         if (first_round) {text_directions();}
         if (player_choice >= LEVELS) {first_round = false;} // Player has played a level
-        // Select level or returns a NULL scene
-        scene_t* scene = level_select(player_choice, multiplayer);
+        // Select level, or no scene for the leaderboard
+        scene_t* scene = (player_choice >= LEVELS) ? level_select(player_choice, multiplayer) : NULL;
         entry_t* entry_player1 = entry_init(name1);
         entry_t* entry_player2 = entry_init(name2);
+        sdl_camera_reset();
 
         time_since_last_tick(); // Need to call this before so dt gets reset
         // If not the first tick will be 1 to 2 seconds vs 0.2
@@ -227,7 +212,7 @@ int main()
             else {sdl_on_key((key_handler_t) on_key);}
 
             double dt = time_since_last_tick();
-            scene_tick(scene, dt);
+            scene_advance(scene, dt);
             sdl_render_scene(scene);
             text_level_info(scene, multiplayer);
             sdl_render();
@@ -277,4 +262,5 @@ int main()
         if(sdl_is_done(NULL)) {player_choice = menu_quit(); break;}
     }
     if (multiplayer == QUIT_VALUE) {sdl_cleanup();}
+    shape_templates_free();
 }
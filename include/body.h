@@ -21,6 +21,32 @@
 typedef struct body body_t;
 
 
+// How a body moves. A DYNAMIC body is moved by forces and impulses. A
+// KINEMATIC body moves at its velocity but ignores forces and impulses. A
+// STATIC body never moves, and is skipped by body_tick() and scene_tick().
+typedef enum body_kind
+{
+    BODY_DYNAMIC,
+    BODY_KINEMATIC,
+    BODY_STATIC
+} body_kind_t;
+
+
+// The most contacts a body keeps between resolutions (see body_add_contact()).
+#define BODY_MAX_CONTACTS 8
+
+
+// Which sides of a body are touching something solid, as of the last time
+// its contacts were resolved (see body_resolve_contacts()).
+typedef struct contact
+{
+    bool left;
+    bool right;
+    bool above;
+    bool below;
+} contact_t;
+
+
 // Initializes a body without any info. Acts like body_init_with_info() where info and info_freer are NULL.
 body_t *body_init(shape_t *shape, double mass, rgb_color_t color);
 
@@ -44,6 +70,15 @@ void body_free(body_t *body);
 shape_t *body_get_shape(body_t *body);
 
 
+// Gets the shape of a body itself rather than a copy, e.g. for collision checks
+// which run every tick. The shape belongs to the body and must not be freed.
+shape_t *body_shape(body_t *body);
+
+
+// Gets the bounding box of a body. Unlike body_get_shape(), nothing is copied.
+extrema_t body_get_extrema(body_t *body);
+
+
 // Gets the current center of mass of a body.
 vector_t body_get_centroid(body_t *body);
 
@@ -120,9 +155,73 @@ void body_remove(body_t *body);
 bool body_is_removed(body_t *body);
 
 
+// Makes body_remove() add the body to the given list (or nothing, if NULL),
+// so whoever owns the body finds out without checking it every tick. The
+// list must outlive the body.
+void body_set_remove_list(body_t *body, list_t *list);
+
+
+// Sets how the body moves. Bodies are DYNAMIC unless set otherwise. Must be
+// called before the body is added to a scene.
+void body_set_kind(body_t *body, body_kind_t kind);
+
+
+// Gets how the body moves.
+body_kind_t body_get_kind(body_t *body);
+
+
+// Returns whether the body never moves.
+bool body_is_static(body_t *body);
+
+
+// Puts a body to sleep, or wakes it up. A scene does not tick a body that is
+// asleep, nor run the interactions that only involve asleep or static bodies
+// (see scene_set_activity_margin()). Forces and impulses added to the body are
+// dropped when it falls asleep or wakes up.
+void body_set_asleep(body_t *body, bool asleep);
+
+
+// Returns whether the body is asleep.
+bool body_is_asleep(body_t *body);
+
+
 // Translates the shape of the body.
 void body_translate(body_t *body, vector_t translate);
 
+
+// Records that the body runs into something solid, to be pushed out of it by
+// the next body_resolve_contacts(). The body needs to move depth along the unit
+// normal to get out, and touches it on the given sides. Once BODY_MAX_CONTACTS
+// are kept, a new contact replaces the shallowest one if it is deeper.
+void body_add_contact(body_t *body, vector_t normal, double depth, contact_t sides);
+
+
+// Pushes the body out of everything recorded with body_add_contact() since the
+// last call, with a single translation that satisfies all of them (e.g. two
+// blocks side by side only lift the body once). Sets which sides of the body
+// are touching something to the sides of those contacts. Called by
+// scene_tick() on every awake body before it is ticked.
+void body_resolve_contacts(body_t *body);
+
+
+// Gets which sides of the body are touching something solid.
+contact_t body_get_contact(body_t *body);
+
+
+// Gets the list of interactions the body takes part in. It is kept up to date
+// by the scene and does not own the interactions.
+list_t *body_get_interactions(body_t *body);
+
+
+// Remembers the current centroid as the start of the next tick. Called by
+// scene_tick() on every body that can move.
+void body_save_centroid(body_t *body);
+
+
+// Gets the centroid a fraction alpha (0 to 1) of the way through the last
+// tick, for drawing between ticks. body_set_centroid() skips the blend.
+vector_t body_get_interpolated_centroid(body_t *body, double alpha);
+
 // limits max velocity of player so it deosn't go too fast
 void body_velocity_limit(body_t *(body));
 
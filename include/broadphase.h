@@ -0,0 +1,72 @@
+#ifndef __BROADPHASE_H__
+#define __BROADPHASE_H__
+
+#include "body.h"
+#include "shape.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+/* OVERVIEW:
+*
+* The broad phase keeps every collidable body of a scene sorted by the left
+* edge of its bounding box (sweep and prune along x). Each tick the order is
+* repaired with an insertion sort, which is close to linear because bodies
+* only move a little between ticks. Sweeping the sorted list then yields
+* every pair of bodies whose bounding boxes overlap, without ever looking at
+* pairs that are far apart. Static bodies (see body_set_kind()) are never
+* paired with each other, and their boxes are only worked out once. Asleep
+* bodies (see body_set_asleep()) are treated the same way until they wake up.
+*/
+
+// A pair of bodies whose bounding boxes overlap.
+typedef struct body_pair
+{
+    body_t *body1;
+    body_t *body2;
+} body_pair_t;
+
+
+typedef struct broadphase broadphase_t;
+
+
+// Allocates memory for an empty broad phase.
+broadphase_t *broadphase_init(size_t initial_size);
+
+
+// Releases the memory allocated for a broad phase. Does not free the bodies.
+void broadphase_free(broadphase_t *broadphase);
+
+
+// Starts tracking a body.
+void broadphase_add(broadphase_t *broadphase, body_t *body);
+
+
+// Stops tracking a body. Must be called before the body is freed.
+void broadphase_remove(broadphase_t *broadphase, body_t *body);
+
+
+// Stops tracking every body marked for removal (see body_remove()) in a single
+// pass. Must be called before those bodies are freed.
+void broadphase_remove_marked(broadphase_t *broadphase);
+
+
+// Gets the bounding box a body is tracked with: its own, grown by a small
+// margin on every side.
+extrema_t broadphase_box(body_t *body);
+
+
+// Re-sorts the bodies by their current bounding boxes and collects every pair
+// of bodies whose bounding boxes overlap.
+void broadphase_update(broadphase_t *broadphase);
+
+
+// Gets the number of overlapping pairs found by the last update.
+size_t broadphase_num_pairs(broadphase_t *broadphase);
+
+
+// Gets an overlapping pair found by the last update.
+body_pair_t broadphase_get_pair(broadphase_t *broadphase, size_t index);
+
+
+#endif // #ifndef __BROADPHASE_H__
@@ -27,6 +27,10 @@
 *     If any of the projection of the shapes do not overlap on each normal (or axis)
 *     Then according to SAT theorem, they do not collide.
 *     In addition, the overlap between two objects is computed.
+*     Two BOX shapes (axis-aligned rectangles) skip this: the overlap of their
+*     extrema along x and y already tells whether and along which axis they collide.
+*     Circles also skip it: they are tested against the other shape's closest
+*     point to their centroid, which only needs their centroid and radius.
 *
 *
 * If you have more questions: ask Julen or look up SAT theorem and collisions.
@@ -48,8 +52,9 @@ typedef struct collision_info
 } collision_info_t;
 
 
-// If objects are close then return true.
-bool collision_possible(shape_t *shape1, shape_t *shape2, collision_info_t info);
+// If objects are close then return true, and stores how much their bounding
+// boxes overlap along x and y in info's overlap_v.
+bool collision_possible(shape_t *shape1, shape_t *shape2, collision_info_t *info);
 
 
 // Projects vertex in the shape onto the inputted axis, and returns projected vector of greatest
@@ -61,6 +66,42 @@ vector_t shape_project(shape_t *shape, vector_t axis);
 double get_overlap(vector_t v1, vector_t v2);
 
 
+// Collides two BOX shapes using only their extrema. The axis is x or y, whichever
+// has the smaller overlap, pointing from the first box towards the second.
+collision_info_t find_box_collision(shape_t *shape1, shape_t *shape2);
+
+
+// Returns the same collision seen from the other shape, i.e. with the axis
+// pointing the other way.
+collision_info_t collision_flip(collision_info_t info);
+
+
+// Sweeps a bounding box along a displacement, and finds how far along it (0 to 1)
+// the box first touches a second box that stays put. Returns -1 if the boxes do
+// not meet along the way, or already overlap at the start. When they meet, axis
+// is set to the x or y axis they meet along, pointing from the moving box
+// towards the other one.
+double find_time_of_impact(extrema_t moving, vector_t displacement, extrema_t target, vector_t *axis);
+
+
+// Collides two circles using their centroids and radii.
+collision_info_t find_circle_collision(shape_t *circle1, shape_t *circle2);
+
+
+// Collides a circle with a BOX using the point of the box closest to the circle.
+collision_info_t find_circle_box_collision(shape_t *circle, shape_t *box);
+
+
+// Collides a circle with a convex polygon using the point on the polygon's edges
+// closest to the circle.
+collision_info_t find_circle_polygon_collision(shape_t *circle, shape_t *polygon);
+
+
+// Projects both shapes onto each of the axes, keeping the axis with the smallest
+// overlap in info. Returns false as soon as the shapes do not overlap on an axis.
+bool find_min_overlap(shape_t *shape1, shape_t *shape2, vector_t *axes, size_t size, collision_info_t *info);
+
+
 // Returns the axis along which the objects have collided; if the axis is {0,
 // 0}, no collision occurred.
 collision_info_t find_collision(body_t *body1, body_t *body2);
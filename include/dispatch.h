@@ -0,0 +1,64 @@
+#ifndef __DISPATCH_H__
+#define __DISPATCH_H__
+
+#include "body.h"
+#include "sprite.h"
+#include "interaction.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+/* OVERVIEW:
+*
+* A dispatch table maps a pair of body types to the collision handlers run
+* between bodies of those types. A type is the role and subrole of a body's
+* sprite, e.g. (PLAYER, any subrole) and (ENEMY, GOOMBA). Handlers are
+* registered once per pair of types instead of once per pair of bodies; the
+* scene looks them up when the broad phase first finds two bodies close to
+* each other (see scene_add_pair_handler()).
+*/
+
+// Matches every subrole of a role.
+#define DISPATCH_ANY_SUBROLE ((subrole_t) -1)
+// The most handlers a pair of bodies can match.
+#define DISPATCH_MAX_MATCHES 4
+
+
+typedef struct dispatch dispatch_t;
+
+
+// A handler that applies to a pair of bodies. The handler expects the bodies in
+// the order of the types it was registered with; swapped is true if that is
+// the opposite of the order they were looked up in.
+typedef struct dispatch_match
+{
+    force_creator_t handler;
+    void *aux;
+    bool swapped;
+} dispatch_match_t;
+
+
+// Allocates memory for an empty dispatch table.
+dispatch_t *dispatch_init(void);
+
+
+// Releases the memory allocated for a dispatch table. Does not free the aux
+// values.
+void dispatch_free(dispatch_t *dispatch);
+
+
+// Registers a handler between bodies of the first type and bodies of the
+// second type, which is passed the bodies in that order. Either subrole can be
+// DISPATCH_ANY_SUBROLE. The aux value is shared by every interaction created
+// from the handler, so it is not freed with them.
+void dispatch_add(dispatch_t *dispatch, role_t role1, subrole_t subrole1, role_t role2, subrole_t subrole2,
+    force_creator_t handler, void *aux);
+
+
+// Finds the handlers registered between the types of two bodies, in the order
+// they were registered, and writes up to max of them to matches. Bodies
+// without a sprite match nothing. Returns the number of handlers found.
+size_t dispatch_find(dispatch_t *dispatch, body_t *body1, body_t *body2, dispatch_match_t *matches, size_t max);
+
+
+#endif // #ifndef __DISPATCH_H__
@@ -19,7 +19,8 @@
 
 // Adds a force creator to a scene that calls a given collision handler function each time two bodies collide.
 // This generalizes create_destructive_collision() from last week, allowing different things to happen on a collision.
-// It should only be called once while the bodies are still colliding.
+// The handler is run while the bodies are close to each other, and tells whether
+// they touch with interaction_get_event() (see scene_add_collision_force_creator()).
 void create_collision(scene_t *scene, body_t *body1, body_t *body2, force_creator_t handler, void *aux, free_func_t freer);
 
 
@@ -43,8 +43,12 @@ void gameplay_token(interaction_t* interaction);
 
 // interactions with player and enemy
 void gameplay_goomba(interaction_t* interaction);
+// Keeps a squashed goomba still, and removes it after a while
+void gameplay_goomba_squashed(interaction_t* interaction);
 void gameplay_koopa(interaction_t* interaction);
 void gameplay_koopa_enemy(interaction_t* interaction);
+// Turns a walking koopa the way it is moving
+void gameplay_koopa_facing(interaction_t* interaction);
 
 // Gameplay for platforms --------------------------------------------------------------------------------------------------------------
 
@@ -68,8 +72,10 @@ void gameplay_invisible_block(interaction_t* interaction);
 // Players because invicible for a few seconds
 void gameplay_star_powerup(interaction_t* interaction);
 
-// Fireball interaction, fireball kills all enemies and only lasts 3 bounces 
+// Fireball interaction, fireball kills every enemy it touches
 void gameplay_fireball(interaction_t* interaction);
+// Removes a fireball after it has been around for a while
+void gameplay_fireball_lifetime(interaction_t* interaction);
 
 // PLAYER gameplay --------------------------------------------------------------------------------------------------
 
@@ -28,14 +28,21 @@ void add_platform_corners(scene_t *scene, vector_t p1, vector_t p2, subrole_t su
 // Since firball is added mid game all its interactions need to be set when its added
 void initialize_fireball(scene_t *scene, body_t *fireball);
 
-// Initializes all necessary interactions for all bodies in scene. This should
-// be called only after all bodies have been added.
+// Registers the handlers between every pair of body types that react to each
+// other (see scene_add_pair_handler()). Must be called once per scene, before
+// it is ticked.
+void add_pair_handlers(scene_t *scene);
+
+// Registers the pair handlers and initializes the actions of every body in the
+// scene. This should be called only after all bodies have been added.
 void add_interactions(scene_t *scene);
 
-// Initializes actions between the platform and a role
-void platform_roles_init_actions(scene_t *scene, body_t *body);
-// Initialzies actions between enemies
-void enemy_enemy_init_actions(scene_t* scene, list_t* list_bodies, body_t* body, size_t size, size_t curr_index);
+// Initializes the actions of a body that was just added, such as gravity. Its
+// interactions with other bodies come from the pair handlers, so nothing else
+// in the scene needs to be wired to it. Used when a level is added to the scene
+// a piece at a time (see spawner.h), instead of add_interactions(). Must be
+// called exactly once per body.
+void initialize_body(scene_t *scene, body_t *body);
 
 
 #endif
@@ -1,6 +1,11 @@
+#ifndef __INTERACTION_H__
+#define __INTERACTION_H__
+
 #include "stdio.h"
 #include "list.h"
 #include "body.h"
+#include "sprite.h"
+#include "collision.h"
 
 #include <stdlib.h>
 #include <math.h>
@@ -11,6 +16,48 @@
 // A 'interaction' which contains information relevant for a force_creator_t.
 typedef struct interaction interaction_t;
 
+// What happened between the two bodies of a collision interaction (see
+// scene_add_collision_force_creator()) in the current tick, compared to the
+// tick before.
+typedef enum contact_event
+{
+    // Apart now, and apart before.
+    CONTACT_NONE,
+    // Touching now, but apart before.
+    CONTACT_BEGIN,
+    // Touching now, and touching before.
+    CONTACT_STAY,
+    // Apart now (or one of them is being removed), but touching before.
+    CONTACT_END
+} contact_event_t;
+
+// State that a gameplay handler keeps from tick to tick. It lives inside the
+// interaction, so handlers update it in place instead of allocating a new aux
+// every tick. Each handler only touches its own member, and everything starts
+// at zero.
+typedef union interaction_state
+{
+    // gameplay_patrol: seconds since the bot last turned around.
+    struct {double time;} patrol;
+    // gameplay_goomba_squashed: seconds since the goomba was squashed.
+    struct {double time_squashed;} goomba;
+    // gameplay_koopa: times the koopa was jumped on.
+    struct {size_t hits;} koopa;
+    // gameplay_star_powerup: seconds the player has been invincible for.
+    struct {double time_invincible;} star;
+    // gameplay_fireball_lifetime: seconds since the fireball was thrown.
+    struct {double time;} fireball;
+    // gameplay_regular_block: the sides of the other body the block has been
+    // touching since they collided.
+    struct {contact_t sides;} block;
+    // gameplay_item_block: whether the block was used.
+    struct {bool used;} item;
+} interaction_state_t;
+
+// The position of an interaction that is not in the scene's list of the
+// interactions to run (see interaction_get_active()).
+#define INTERACTION_INACTIVE ((size_t) -1)
+
 // A function which adds some forces or impulses to bodies, e.g. from collisions, gravity, or spring forces.
 typedef void (*force_creator_t)(interaction_t *interaction);
 
@@ -34,11 +81,53 @@ force_creator_t interaction_get_forcer(interaction_t* interaction);
 
 list_t* interaction_get_bodies(interaction_t* interaction);
 
-bool interaction_is_colliding(interaction_t* interaction);
+void interaction_set_aux(interaction_t* interaction, void* aux);
 
-void interaction_set_colliding(interaction_t* interaction, bool value);
+// Gets the position of the interaction in the scene's list of interactions.
+size_t interaction_get_index(interaction_t* interaction);
 
-void interaction_set_aux(interaction_t* interaction, void* aux);
+void interaction_set_index(interaction_t* interaction, size_t index);
+
+// Gets the position of the interaction in the scene's list of the interactions
+// it runs each tick, or INTERACTION_INACTIVE if it is not in that list.
+size_t interaction_get_active(interaction_t* interaction);
+
+void interaction_set_active(interaction_t* interaction, size_t active);
+
+// Gets the position of the interaction in the list of interactions of its body
+// at the given index (see body_get_interactions()).
+size_t interaction_get_link(interaction_t* interaction, size_t index);
+
+void interaction_set_link(interaction_t* interaction, size_t index, size_t link);
+
+// Gets the handler state stored in the interaction (see interaction_state_t).
+interaction_state_t* interaction_get_state(interaction_t* interaction);
+
+// Whether the interaction only runs while the broad phase finds its two bodies
+// close to each other.
+bool interaction_is_on_contact(interaction_t* interaction);
+
+void interaction_set_on_contact(interaction_t* interaction, bool value);
+
+// Gets the last scene tick in which the interaction's bodies were close.
+size_t interaction_get_tick(interaction_t* interaction);
+
+void interaction_set_tick(interaction_t* interaction, size_t tick);
+
+// Gets what happened between the bodies of a collision interaction this tick.
+// Set by the scene before the interaction is run.
+contact_event_t interaction_get_event(interaction_t* interaction);
+
+// Returns whether the bodies of a collision interaction are touching this tick,
+// i.e. the event is CONTACT_BEGIN or CONTACT_STAY.
+bool interaction_is_touching(interaction_t* interaction);
+
+// Gets the collision between the bodies of a collision interaction (in the
+// order of the interaction's bodies) as the scene found it this tick. Handlers
+// read it instead of calling find_collision() again. For CONTACT_END it is the
+// last collision the bodies had.
+collision_info_t interaction_get_collision(interaction_t* interaction);
+
+void interaction_set_contact(interaction_t* interaction, contact_event_t event, collision_info_t collision);
 
-// Returns if two ticks collided during last tick
-bool interaction_colliding(interaction_t* interaction);
+#endif // #ifndef __INTERACTION_H__
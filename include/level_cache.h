@@ -0,0 +1,85 @@
+#ifndef __LEVEL_CACHE_H__
+#define __LEVEL_CACHE_H__
+
+#include "vector.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* OVERVIEW:
+*
+* The first time a level file is loaded, what was read from it is saved next
+* to it as a flat binary image (world1_level1.txt -> world1_level1.bin): a
+* header, then one fixed-size record per line that added something. It holds
+* no pointers, so later loads map the image into memory and build the level
+* straight from the records, without reading any text. An image is only used
+* while it is newer than its level file and was written by the same build
+* layout; otherwise the text is read again and the image rewritten.
+*/
+
+// What a line of a level file adds.
+typedef enum level_directive
+{
+    LEVEL_BACKGROUND,
+    LEVEL_BORDERS,
+    LEVEL_BLOCK,
+    LEVEL_ITEM,
+    LEVEL_TUNNEL,
+    LEVEL_ENEMY,
+    LEVEL_TOKEN
+} level_directive_t;
+
+
+// The side of a tunnel block the player enters from.
+typedef enum level_side
+{
+    LEVEL_TOP,
+    LEVEL_LEFT,
+    LEVEL_BOTTOM,
+    LEVEL_RIGHT
+} level_side_t;
+
+
+// One line of a level file, as it is stored in the image. subrole is what a
+// background, block or enemy is, or the powerup of an item block. p1 and p2
+// are the corners of blocks, the size of backgrounds and borders (p1), and
+// the position of enemies and tokens (p1). The rest is only used by tunnels.
+typedef struct level_record
+{
+    uint32_t directive;
+    uint32_t subrole;
+    vector_t p1;
+    vector_t p2;
+    uint32_t side;
+    double sublevel;
+    vector_t exit;
+} level_record_t;
+
+
+typedef struct level_cache level_cache_t;
+
+
+// Maps the image of a level file into memory. Returns NULL if there is no
+// image, or it is out of date.
+level_cache_t *level_cache_open(const char *source);
+
+
+// Unmaps an image.
+void level_cache_close(level_cache_t *cache);
+
+
+// Gets the number of records in an image.
+size_t level_cache_size(level_cache_t *cache);
+
+
+// Gets the records of an image. They stay valid until it is closed.
+const level_record_t *level_cache_records(level_cache_t *cache);
+
+
+// Saves the records read from a level file as its image. Returns false if it
+// could not be written, which only means the next load reads the text again.
+bool level_cache_write(const char *source, const level_record_t *records, size_t count);
+
+
+#endif // #ifndef __LEVEL_CACHE_H__
@@ -9,27 +9,46 @@
 
 #include <SDL2/SDL.h>
 
-// A function which adds some forces or impulses to bodies, e.g. from collisions, gravity, or spring forces.
-typedef void (*level_creator_t)(scene_t* scene);
-
-// Level selector
+/* OVERVIEW:
+*
+* Levels are described by text files in resources/levels/, and listed by ID
+* in resources/levels/levels.txt, one "<id> <file>" per line. Both are read
+* when a level is loaded, so levels can be added or tuned without rebuilding.
+*
+* A level file has one thing per line; everything after a '#' is a comment.
+* Positions are in pixels, and blocks are given by two opposite corners:
+*
+*   background <LEVEL...> <width> <height>
+*   borders <width> <height>                 (also the level's bounds)
+*   block <REGULAR_BLOCK|DEATH_BLOCK|INVISIBLE_BLOCK> <x1> <y1> <x2> <y2>
+*   item <..._POWERUP> <x1> <y1> <x2> <y2>
+*   tunnel <level id> <top|left|bottom|right> <exit x> <exit y> <x1> <y1> <x2> <y2>
+*   enemy <GOOMBA|KOOPA> <x> <y>
+*   token <x> <y>
+*
+* What is read from a level file is saved next to it as a binary image (see
+* level_cache.h), which later loads build the level from instead.
+*/
+
+// Level selector. Returns NULL, saying so, if there is no level with that ID.
 scene_t* level_select(double choice, bool multiplayer);
 
-// Runs desired level of the game.
-scene_t* level_load(level_creator_t level, bool multiplayer);
+// Looks a level up in the registry, writing the path of its file to path.
+// Returns false, printing nothing, if there is no level with that ID.
+bool level_find(const char *id, char *path, size_t size);
+
+// Runs the level described by a level file, or returns NULL if it cannot be
+// opened. Compiled with -DLEVEL_STATS, prints how long loading took, and
+// whether the image was used, to stderr.
+scene_t* level_load(const char *path, bool multiplayer);
 
-// Loads ingame sublevel caused by using a tunnel
+// Loads ingame sublevel caused by using a tunnel, or returns NULL if no tunnel
+// has been entered.
 scene_t* sublevel_load(bool multiplayer);
 
-// Sets up the borders for the level
+// Sets up the borders for the level, and the scene's bounds (see
+// scene_set_bounds()) from its top-right corner.
 void level_borders(scene_t* scene, vector_t max);
 
-// Creates scene for each level
-void world1_level1(scene_t* scene);
-void world1_level2(scene_t* scene);
-void world1_level2_sublevel1(scene_t* scene);
-void world1_level3(scene_t* scene);
-void world1_level3_sublevel1(scene_t* scene);
-
 
 #endif
@@ -13,8 +13,12 @@ typedef struct list list_t;
 // A function that can be called on list elements to release their resources.
 typedef void (*free_func_t)(void *);
 
+// A function that tests a list element, e.g. for list_remove_if().
+typedef bool (*predicate_t)(void *);
+
 
 // Allocates memory for a new list with space for the given number of elements.
+// If freer is NULL, the list does not own its elements and never frees them.
 list_t *list_init(size_t initial_size, free_func_t freer);
 
 
@@ -22,6 +26,11 @@ list_t *list_init(size_t initial_size, free_func_t freer);
 void list_free(list_t *list);
 
 
+// Releases the memory allocated for a list without freeing the elements in it,
+// whatever the list's freer.
+void list_free_shallow(list_t *list);
+
+
 // Replaces on element at specified index.
 void list_replace(list_t *list, size_t index, void *elem);
 
@@ -38,6 +47,26 @@ void *list_get(list_t *list, size_t index);
 void *list_remove(list_t *list, size_t index);
 
 
+// Removes the element at a given index in a list and returns it, moving the last element into its place.
+// Takes constant time, but does not keep the order of the list.
+void *list_swap_remove(list_t *list, size_t index);
+
+
+// Overwrites the element at a given index WITHOUT freeing the old one. The element may be NULL, which
+// leaves a hole until list_compact() is called.
+void list_set(list_t *list, size_t index, void *elem);
+
+
+// Removes every NULL element from a list, keeping the order of the rest.
+void list_compact(list_t *list);
+
+
+// Removes every element for which the predicate returns true in a single pass, keeping the order of the
+// rest. The removed elements are appended to the removed list, or freed with the list's freer if it is NULL.
+// Returns the number of elements removed.
+size_t list_remove_if(list_t *list, predicate_t predicate, list_t *removed);
+
+
 // Appends an element to the end of a list.
 // If the list is filled to capacity, resizes the list to fit more elements and asserts that the resize succeeded.
 void list_add(list_t *list, void *elem);
@@ -0,0 +1,182 @@
+#ifndef __MEMORY_H__
+#define __MEMORY_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* OVERVIEW:
+*
+* An arena hands out memory by bumping a pointer through large blocks, and
+* gives all of it back at once when it is freed. A scene owns an arena, and
+* everything that lives as long as the level (bodies, shapes, sprites,
+* interactions, lists, aux values) is carved from it, so unloading a level is
+* a handful of free() calls instead of one per object.
+*
+* The engine allocates through mem_alloc() and friends instead of malloc().
+* They use the current arena (see mem_use_arena()) if there is one, and the
+* heap otherwise. Every allocation remembers where it came from, so
+* mem_free() can be called on either kind: heap memory is returned right
+* away, while arena memory is only reclaimed when its arena is freed.
+*
+* The exception is large arena allocations (MEM_RECYCLE_SIZE bytes or more),
+* i.e. the backing arrays of growing containers. Their size is rounded up to
+* a power of two, and freeing or outgrowing one hands it back to its arena,
+* which reuses it for the next allocation of the same size. A scene's lists,
+* maps and broad phase can then grow and shrink for as long as the level runs
+* without the arena growing with them.
+*/
+
+// Arena allocations of at least this many bytes are reused once freed.
+#define MEM_RECYCLE_SIZE 512
+
+typedef struct arena arena_t;
+
+
+// Allocates memory for an empty arena, which grows in blocks of at least
+// block_size bytes.
+arena_t *arena_init(size_t block_size);
+
+
+// Releases every allocation carved from the arena, and the arena itself.
+void arena_free(arena_t *arena);
+
+
+// Gets the number of bytes handed out by the arena so far.
+size_t arena_used(arena_t *arena);
+
+
+// Takes back everything carved from the arena, keeping its memory to be carved
+// again.
+void arena_reset(arena_t *arena);
+
+
+// Makes mem_alloc() carve memory from the given arena, or from the heap if it
+// is NULL. Returns the arena that was current before, so callers can restore
+// it once they are done.
+arena_t *mem_use_arena(arena_t *arena);
+
+
+// Gets the arena mem_alloc() currently carves memory from, or NULL.
+arena_t *mem_current_arena(void);
+
+
+// Allocates size bytes from the current arena, or the heap.
+void *mem_alloc(size_t size);
+
+
+// Allocates size bytes from the given arena, or the heap if it is NULL,
+// whichever arena is current.
+void *mem_alloc_from(arena_t *arena, size_t size);
+
+
+// Allocates zeroed memory for count elements of the given size.
+void *mem_calloc(size_t count, size_t size);
+
+
+// Resizes an allocation made by mem_alloc(). The memory stays with whichever
+// arena (or the heap) it came from, not the current one.
+void *mem_realloc(void *ptr, size_t size);
+
+
+// Releases an allocation made by mem_alloc(). Does nothing for NULL, or for
+// memory carved from an arena unless it is large enough to be reused (see
+// MEM_RECYCLE_SIZE).
+void mem_free(void *ptr);
+
+
+// Gets the arena an allocation was carved from, or NULL if it is on the heap.
+arena_t *mem_owner(void *ptr);
+
+
+/* POOLS:
+*
+* A pool hands out objects of a single type. Freed objects are kept on a free
+* list and handed out again by the next pool_alloc(), so entities that come
+* and go during a level (fireballs, powerups) reuse the same memory instead of
+* carving more out of the scene's arena. Each arena keeps its own free lists,
+* so an object is only ever reused within the arena it was carved from.
+*
+* Compile with -DPOOL_STATS to count what each pool does (see
+* pool_print_stats()).
+*/
+
+// How many objects a pool has handed out and taken back.
+typedef struct pool_stats
+{
+    size_t allocated;
+    size_t reused;
+    size_t freed;
+    size_t live;
+    size_t peak;
+} pool_stats_t;
+
+
+typedef struct pool
+{
+    const char *name;
+    size_t size;
+    // Which free list of an arena the pool uses; set the first time the pool
+    // is used.
+    size_t id;
+    // Freed objects that came from the heap.
+    void *free_list;
+    pool_stats_t stats;
+} pool_t;
+
+
+// The most pools a program can use.
+#define MEM_MAX_POOLS 24
+
+// Initializer for a pool of objects of the given type, e.g.
+// pool_t BODY_POOL = POOL_INIT("body", body_t);
+#define POOL_INIT(name, type) {name, sizeof(type), 0, NULL, {0, 0, 0, 0, 0}}
+
+
+// Allocates an object from the pool, reusing a freed one from the current
+// arena (or the heap) if there is one.
+void *pool_alloc(pool_t *pool);
+
+
+// Allocates an object from the pool out of the given arena (or the heap if it
+// is NULL), whichever arena is current.
+void *pool_alloc_from(pool_t *pool, arena_t *arena);
+
+
+// Gives an object back to the pool it was allocated from.
+void pool_free(pool_t *pool, void *ptr);
+
+
+// Releases the freed objects every pool is keeping that came from the heap.
+// Objects from an arena go along with it. Called by scene_free().
+void pool_clear(void);
+
+
+// Gets the statistics of a pool. They are all zero unless compiled with
+// -DPOOL_STATS.
+pool_stats_t pool_get_stats(pool_t *pool);
+
+
+// Prints the statistics of every pool used so far to stderr. Does nothing
+// unless compiled with -DPOOL_STATS.
+void pool_print_stats(void);
+
+
+
+/* SCRATCH MEMORY:
+*
+* Memory that is only needed until the end of the current frame (e.g. vertex
+* arrays for drawing, strings to be written on screen) comes from a separate
+* arena that is reset once per frame by sdl_render(). There is nothing to free
+* and nothing to leak.
+*/
+
+// Allocates size bytes of scratch memory, which stays valid until the next
+// frame_reset(). Must not be passed to mem_free().
+void *frame_alloc(size_t size);
+
+
+// Takes back all scratch memory handed out since the last reset.
+void frame_reset(void);
+
+
+#endif // #ifndef __MEMORY_H__
@@ -0,0 +1,40 @@
+#ifndef __PAIR_MAP_H__
+#define __PAIR_MAP_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+
+// A hash map whose keys are unordered pairs of pointers, i.e. (a, b) and
+// (b, a) refer to the same entry. Used to look up per-pair data (such as the
+// interactions between two bodies) in constant time.
+typedef struct pair_map pair_map_t;
+
+
+// Allocates memory for an empty pair map with space for the given number of
+// entries.
+pair_map_t *pair_map_init(size_t initial_size);
+
+
+// Releases the memory allocated for a pair map. Does NOT free the values.
+void pair_map_free(pair_map_t *map);
+
+
+// Gets the value stored for the pair (a, b), or NULL if there is none.
+void *pair_map_get(pair_map_t *map, void *a, void *b);
+
+
+// Stores a value for the pair (a, b), replacing any value already stored.
+void pair_map_put(pair_map_t *map, void *a, void *b, void *value);
+
+
+// Removes the entry for the pair (a, b) and returns its value, or NULL if
+// there was no such entry.
+void *pair_map_remove(pair_map_t *map, void *a, void *b);
+
+
+// Gets the number of entries in the map.
+size_t pair_map_size(pair_map_t *map);
+
+
+#endif // #ifndef __PAIR_MAP_H__
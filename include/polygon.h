@@ -10,13 +10,14 @@
 // Computes the area of a polygon.
 //  A = 0.5 * |[sum from i = 1 to (n - 1) x_i * y_(i + 1) + ... + x_n * y_1] -
 //  [sum from i = 1 to (n - 1) y_i * x_(i + 1) + ... + y_n * x_1]|
-double polygon_area(list_t* verticies);
+double polygon_area(vector_t* verticies, size_t size);
 
 
-// Returns a list with all unit normals of a shape, for use in collision.c.
-list_t* polygon_normals(list_t* verticies);
+// Writes the unit normal of every edge of a polygon into normals, which must
+// have room for size vectors. For use in collision.c.
+void polygon_normals(vector_t* verticies, size_t size, vector_t* normals);
 
 
 // Computes the centroid of a polygon.
-vector_t polygon_centroid(list_t* verticies);
+vector_t polygon_centroid(vector_t* verticies, size_t size);
 
@@ -5,6 +5,8 @@
 #include "body.h"
 #include "interaction.h"
 #include "sprite.h"
+#include "memory.h"
+#include "dispatch.h"
 
 #include <assert.h>
 #include <stdlib.h>
@@ -27,13 +29,74 @@ typedef struct scene_bounds
 } scene_bounds_t;
 
 
-// Allocates memory for an empty scene.
+// Told about a body the scene is about to free because it was removed, along
+// with the auxiliary value it was registered with.
+typedef void (*remove_handler_t)(void *aux, body_t *body);
+
+
+// Allocates memory for an empty scene, along with the arena its objects are
+// carved from (see memory.h).
 scene_t *scene_init();
 
 
 // Releases memory allocated for a given scene and all the lists and force creators it contains.
+// If everything in the scene was carved from its arena, this just frees the arena.
+// The freed heap objects the pools were keeping are released too (see pool_clear()).
 void scene_free(scene_t *scene);
 
+
+// Registers a function to be called on every body the scene removes and frees,
+// just before it is freed, e.g. to remember that an enemy was killed. A scene
+// has at most one; passing NULL unregisters it.
+void scene_set_remove_handler(scene_t *scene, remove_handler_t handler, void *aux);
+
+
+// Gets the bodies of the scene that never move (see body_set_kind()), e.g. for
+// collision queries that can rely on them staying put. Does not own them.
+list_t *scene_get_statics(scene_t *scene);
+
+
+// Sets how far (along x) a body can get from every player before the scene
+// puts it to sleep (see body_set_asleep()). Bodies are woken up again once a
+// player comes back within the margin; which bodies are asleep is checked
+// every few ticks. Apart from that check, a body that is asleep costs next to
+// nothing per tick, however long the level is. Scenes without players never put
+// anything to sleep. Pass INFINITY to keep every body awake.
+void scene_set_activity_margin(scene_t *scene, double margin);
+
+
+// Sets the length of the fixed ticks scene_advance() runs, SCENE_TIMESTEP by
+// default. Longer ticks mean fewer of them per frame, e.g. on slow hardware.
+// Bodies that move far in a tick are swept against the static bodies they
+// collide with, so they do not pass through thin platforms.
+void scene_set_timestep(scene_t *scene, double timestep);
+
+
+// Sets the corners of the region the level takes up, e.g. for the camera to
+// stay within or to tell when a player reached the end. Unlike the border
+// platforms, they are there whatever part of the level is loaded. Both are the
+// origin until set.
+void scene_set_bounds(scene_t *scene, vector_t min, vector_t max);
+
+
+// Files the static bodies of the scene in a tile grid with cells of the given
+// size (see tile_grid.h) instead of the broad phase, so a body only looks for
+// the solids under the cells it covers. Suits levels built from blocks on a
+// regular grid. Must be called before any static body is added.
+void scene_use_tile_grid(scene_t *scene, double cell_size);
+
+
+// Puts to sleep the bodies too far from every player, and wakes up the ones
+// that are close enough again. Also works out the bodies and interactions the
+// ticks until the next call look at, so those never go through the ones that
+// are asleep. Called by scene_tick() every few ticks.
+void scene_update_activity(scene_t *scene);
+
+
+// Gets the arena the scene's objects are carved from. Make it current (see
+// mem_use_arena()) while building objects for the scene.
+arena_t *scene_get_arena(scene_t *scene);
+
 // Adds a body to a scene.
 void scene_add_body(scene_t *scene, body_t *body, size_t index);
 
@@ -50,17 +113,87 @@ void scene_remove_body(scene_t *scene, size_t index, size_t role);
 void scene_add_bodies_force_creator(scene_t *scene, force_creator_t forcer, void *aux, list_t *bodies, free_func_t freer);
 
 
+// Adds a force creator between exactly two bodies which only does something while
+// the bodies touch. Instead of every tick, it is only invoked in the ticks where
+// the scene's broad phase finds the two bodies close to each other, or while they
+// are still touching. The scene works out whether they touch once per pair and
+// tick, and tells the interaction through interaction_get_event(). Bodies that
+// are touching when the interaction is removed get a last CONTACT_END.
+void scene_add_collision_force_creator(scene_t *scene, force_creator_t forcer, void *aux, list_t *bodies, free_func_t freer);
+
+
+// Adds an interaction to the scene, and to the interaction list of each of its
+// bodies (see body_get_interactions()).
+void scene_add_interaction(scene_t *scene, interaction_t *interaction);
+
+
+// Removes an interaction from the scene and frees it. Takes time proportional to
+// the number of bodies in the interaction, not to the size of the scene.
+void scene_remove_interaction(scene_t *scene, interaction_t *interaction);
+
+
+// Drops the holes left in the scene's list of interactions by removed
+// interactions. Called by scene_tick() once enough of them pile up.
+void scene_compact_interactions(scene_t *scene);
+
+
+// Registers a collision handler between bodies of two types, each a role and a
+// subrole (or DISPATCH_ANY_SUBROLE, see dispatch.h). No interaction is created
+// right away: the first time the broad phase finds two bodies of those types
+// close to each other, the scene adds a collision force creator between them
+// for each handler that matches, and keeps it until one of them is removed.
+// Bodies added later need no wiring of their own. The aux value is not freed by
+// the scene.
+void scene_add_pair_handler(scene_t *scene, role_t role1, subrole_t subrole1, role_t role2, subrole_t subrole2,
+    force_creator_t handler, void *aux);
+
+
+// Removes a collision interaction from the scene's lookup of interactions by pair
+// of bodies. Does not free the interaction.
+void scene_remove_contact(scene_t *scene, interaction_t *interaction);
+
+
 // Executes a tick of a given scene over a small time interval. If any bodies are marked for removal,
 // they should be removed from the scene and freed, along with any force creators acting on them.
 void scene_tick(scene_t *scene, double dt);
 
 
+// Removes and frees every body marked for removal (see body_remove()), along with
+// the interactions acting on it. Called at the end of scene_tick().
+void scene_remove_marked(scene_t *scene);
+
+
+// Advances the scene by the real time elapsed, in fixed ticks (see
+// scene_set_timestep()). Time left over is carried to the next call, and at most SCENE_MAX_STEPS ticks
+// are run per call so a long hitch slows the game down instead of producing one
+// huge step. Returns how far (0 to 1) the scene is into the next tick, which is
+// also kept for drawing (see scene_get_alpha()).
+double scene_advance(scene_t *scene, double dt);
+
+
 // Remove all interactions (i.e. force interactions) associated with the inputted
 // body from the scene.
 void scene_remove_interactions(scene_t *scene, body_t *body);
 
 // Accessor functions ---------------------------------------------------
 
+// Gets how far the scene is into its next tick, as returned by the last call
+// to scene_advance().
+double scene_get_alpha(scene_t *scene);
+
+
+// Gets the length of the scene's ticks (see scene_set_timestep()), e.g. for
+// handlers that time something in seconds.
+double scene_get_timestep(scene_t *scene);
+
+
+// Gets the bottom-left and top-right corners of the region the level takes up
+// (see scene_set_bounds()).
+vector_t scene_get_min(scene_t *scene);
+
+vector_t scene_get_max(scene_t *scene);
+
+
 // Gets the body at a given index in a scene.
 list_t *scene_get_list(scene_t *scene, size_t role);
 
@@ -35,8 +35,9 @@ void sdl_write(TTF_Font* font,
         window_info_t window_info);
 
 
-// Draws a sprite on the window.
-void sdl_draw_sprite(body_t* body, list_t* textures, list_t* frames, SDL_Renderer* renderer, window_info_t window_info);
+// Draws a sprite on the window, alpha of the way between the body's last two
+// ticks.
+void sdl_draw_sprite(body_t* body, double alpha, list_t* textures, list_t* frames, SDL_Renderer* renderer, window_info_t window_info);
 
 
 // Draws a shape_t object on the window.
@@ -5,12 +5,32 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL2_gfxPrimitives.h>
 #include <SDL2/SDL_image.h>
 
 
+// The part of the scene that is currently shown. The view is the window's
+// scene rectangle (center -/+ max_diff) shifted by offset.
+typedef struct camera
+{
+    // How far the view has scrolled, in scene coordinates.
+    vector_t offset;
+
+    // The target is only followed once it leaves this rectangle, given in
+    // view coordinates (i.e. before the offset is applied).
+    vector_t dead_min;
+    vector_t dead_max;
+
+    // The view never scrolls past these scene coordinates, if bounded.
+    vector_t bound_min;
+    vector_t bound_max;
+    bool bounded;
+} camera_t;
+
+
 // Should I move this an write accessors?
 typedef struct window_info
 {
@@ -22,6 +42,8 @@ typedef struct window_info
     vector_t max_diff;
     double scale;
 
+    camera_t camera;
+
 } window_info_t;
 
 
@@ -38,10 +60,28 @@ void window_info_free(window_info_t* window_info);
 double get_scene_scale(window_info_t window_info);
 
 
-// Maps a scene coordinate to a window coordinate.
+// Puts the camera back at the origin with no bounds.
+void camera_reset(window_info_t* window_info);
+
+
+// Stops the camera from scrolling past the given scene coordinates.
+void camera_set_bounds(vector_t min, vector_t max, window_info_t* window_info);
+
+
+// Scrolls the camera just enough to keep the target inside the dead zone, then
+// clamps the view to the bounds.
+void camera_follow(vector_t target, window_info_t* window_info);
+
+
+// Maps a scene coordinate to a window coordinate, as seen through the camera.
 vector_t get_window_position(vector_t scene_pos, window_info_t window_info);
 
 
+// Maps a scene coordinate to a window coordinate, ignoring the camera. Used
+// for text and other overlays that stay put while the level scrolls.
+vector_t get_overlay_position(vector_t scene_pos, window_info_t window_info);
+
+
 // Computes the center of the window in pixel coordinates.
 vector_t get_window_center(SDL_Window* window);
 
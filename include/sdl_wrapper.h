@@ -83,6 +83,20 @@ void sdl_render_scene(scene_t *scene);
 // Clears the SDL window, and renders menu
 void sdl_render();
 
+
+// Scrolls the view to follow a scene position. Only changes where the scene is
+// drawn; no body is moved.
+void sdl_camera_follow(vector_t target);
+
+
+// Stops the view from scrolling past the given scene coordinates.
+void sdl_camera_set_bounds(vector_t min, vector_t max);
+
+
+// Puts the view back at the origin with no bounds, e.g. before drawing a new
+// scene.
+void sdl_camera_reset(void);
+
 // Registers a function to be called every time a key is pressed. Overwrites any existing handler.
 void sdl_on_key(key_handler_t handler);
 
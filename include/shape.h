@@ -24,21 +24,51 @@ typedef struct extrema
 
 extern const int CIRCLE;
 extern const int POLYGON;
+// An axis-aligned rectangle, which collides without the general SAT test.
+extern const int BOX;
 
 
-// A struct which stores a CIRCLE or POLYGON shape and the corresponding 
+// A struct which stores a CIRCLE, POLYGON or BOX shape and the corresponding 
 // vertices. If the shape is of CIRCLE type, it also stores the radius.
 typedef struct shape shape_t;
 
 
-// Initializes a CIRCLE type shape struct.
+// The geometry of a shape, independent of where it is. Identical bodies (e.g.
+// every token, or every block of the same size) share a single template
+// instead of each holding a copy of the same vertices.
+typedef struct shape_template shape_template_t;
+
+
+// Initializes a CIRCLE type shape struct. Only the centroid and radius are stored.
 shape_t* shape_init_circle(vector_t position, double radius);
 
-// Initializes Rectangle
+// Writes size vertices of a circle into vertices, e.g. for drawing it as a
+// polygon.
+void circle_vertices(vector_t position, double radius, size_t size, vector_t* vertices);
+
+// Initializes an axis-aligned rectangle (BOX) from its bottom-left and top-right
+// vertices. Rotating it turns it into a POLYGON.
 shape_t* shape_init_rectangle(vector_t v1, vector_t v2);
 
-// Initializes a POLYGON type shape struct.
-shape_t* shape_init_polygon(list_t* vertices);
+// Initializes a POLYGON type shape struct from an array of size vertices. The
+// vertices are copied, relative to the shape's centroid, so the caller keeps
+// the array.
+shape_t* shape_init_polygon(vector_t* vertices, size_t size);
+
+
+// Gets the template of an axis-aligned BOX of the given width and height,
+// creating it the first time it is asked for.
+shape_template_t* shape_template_box(vector_t size);
+
+
+// Initializes a shape with the geometry of a template, centred at the given
+// position. The shape only stores its own position and world vertices.
+shape_t* shape_init_instance(shape_template_t* template, vector_t centroid);
+
+
+// Frees every template. Any shape made from one must be freed first, so this
+// is called at shutdown, once every scene is freed.
+void shape_templates_free(void);
 
 
 // Frees the memory allocated for a shape object.
@@ -49,12 +79,6 @@ void shape_free(shape_t* shape);
 // Accessors and other operations ---------------------------------------------
 
 
-// Returns a list containing vectors normal to the edges of a shape. If the 
-// shape is a circe, each normal vector projects radially outwards from the 
-// center.
-list_t* shape_normals(shape_t* shape);
-
-
 // Returns an extrema_t object, which stores the minimum and maximum x and y 
 // values of the shape (for use in collisions).
 extrema_t shape_extrema(shape_t* shape);
@@ -62,13 +86,19 @@ extrema_t shape_extrema(shape_t* shape);
 // returns extrema stored in shape
 extrema_t shape_get_extrema(shape_t* shape);
 
+// Returns the vectors normal to the edges of a shape, one per vertex (see
+// shape_num_vertices()). If the shape is a circle, each normal vector projects
+// radially outwards from the center. The array belongs to the shape and must
+// not be freed.
+vector_t* shape_get_normals(shape_t* shape);
+
 
 
 // Returns the area of the inputted shape.
 double shape_area(shape_t* shape);
 
 
-// Translates a shape by a given vector.
+// Translates a shape by a given vector. Takes constant time.
 void shape_translate(shape_t* shape, vector_t translation);
 
 
@@ -84,8 +114,25 @@ vector_t shape_centroid(shape_t* shape);
 int shape_type(shape_t* shape);
 
 
-// Gets the vertices of the shape.
-list_t* shape_vertices(shape_t* shape);
+// Gets the vertices of the shape, as an array of shape_num_vertices() vectors.
+// For a circle, they are generated the first time they are asked for, so
+// collisions should not rely on them.
+// Moving a shape does not touch its vertices; they are brought up to date here,
+// so the array should be treated as read-only and not kept across moves.
+vector_t* shape_vertices(shape_t* shape);
+
+
+// Gets the number of vertices of the shape.
+size_t shape_num_vertices(shape_t* shape);
+
+
+// Returns whether the shape holds any vertices yet. Only a circle can be
+// without, until its vertices are first asked for.
+bool shape_has_vertices(shape_t* shape);
+
+
+// Gets the vertex at a given index in world space.
+vector_t shape_vertex(shape_t* shape, size_t index);
 
 
 // Gets the radius of the shape, if the shape is a CIRCLE.
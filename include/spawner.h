@@ -0,0 +1,79 @@
+#ifndef __SPAWNER_H__
+#define __SPAWNER_H__
+
+#include "scene.h"
+#include "sprite.h"
+#include "vector.h"
+
+#include <stdbool.h>
+
+/* OVERVIEW:
+*
+* A spawner streams a level into its scene. While a spawner is current (see
+* spawner_use()), the add_...() functions of initialize.h only record what
+* they would add to the scene. The records are sorted into chunks along x.
+* Every few ticks, whatever is recorded near a player is added to the scene
+* and wired to what is already there (see initialize_body()). Whatever has
+* fallen far behind (or is far ahead of) every player is removed again, so
+* the bodies and interactions of a scene depend on how much of the level is
+* around the players, not on how long it is.
+*
+* Enemies that were killed and tokens that were collected are not spawned
+* again, and item blocks that were used come back used.
+*/
+
+typedef struct spawner spawner_t;
+
+
+// Which add_...() function a spawn is recorded from.
+typedef enum spawn_kind
+{
+    SPAWN_PLATFORM,
+    SPAWN_PLATFORM_CORNERS,
+    SPAWN_ENEMY,
+    SPAWN_TOKEN,
+    SPAWN_POWERUP
+} spawn_kind_t;
+
+
+// The arguments of a call to an add_...() function. For SPAWN_PLATFORM, p1 is
+// the center and p2 the size; for SPAWN_PLATFORM_CORNERS, they are the
+// corners; everything else only uses p1, as its position. The info of a
+// platform must come from the scene's arena, since it is shared by every body
+// spawned from the record.
+typedef struct spawn
+{
+    spawn_kind_t kind;
+    subrole_t subrole;
+    vector_t p1;
+    vector_t p2;
+    void *info;
+} spawn_t;
+
+
+// Allocates a spawner for a scene from the scene's arena. The scene runs the
+// spawner as part of its ticks and frees it along with everything else.
+spawner_t *spawner_init(scene_t *scene);
+
+
+// Makes the add_...() functions record into the given spawner, or add to the
+// scene right away if it is NULL. Returns the spawner that was current before.
+spawner_t *spawner_use(spawner_t *spawner);
+
+
+// Records a spawn into the current spawner. Returns false, recording nothing,
+// if there is no current spawner.
+bool spawner_record(spawn_t spawn);
+
+
+// Adds to the scene everything recorded near a player, and removes what is far
+// from all of them. Called by the scene every few ticks, and once by
+// level_load() so the first chunks are there from the start.
+void spawner_update(spawner_t *spawner);
+
+
+// Gets the number of records currently added to the scene.
+size_t spawner_num_live(spawner_t *spawner);
+
+
+#endif // #ifndef __SPAWNER_H__
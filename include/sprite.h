@@ -111,15 +111,6 @@ typedef enum subrole_t
 
 } subrole_t;
 
-// Provides information about what a sprite is in contact with.
-typedef struct contact
-{
-    bool left;
-    bool right;
-    bool above;
-    bool below;
-} contact_t;
-
 
 typedef struct sprite sprite_t;
 
@@ -155,18 +146,12 @@ void sprite_add_kills(sprite_t *player);
 // Decrementes health by one.
 void sprite_lower_health(sprite_t *player);
 
-// Returns the contact information of the sprite.
-contact_t sprite_contact(sprite_t *sprite);
-
 // Returns role.
 role_t sprite_role(sprite_t *sprite);
 
 // Gets the sprite's role.
 subrole_t sprite_subrole(sprite_t *player);
 
-// Change the value of the contact fields.
-void sprite_set_contact(sprite_t* player, contact_t contact);
-
 // Applies a powerup.
 void sprite_activate_powerup(sprite_t *sprite, subrole_t powerup);
 
@@ -0,0 +1,50 @@
+#ifndef __TILE_GRID_H__
+#define __TILE_GRID_H__
+
+#include "body.h"
+#include "list.h"
+#include "shape.h"
+
+#include <stdlib.h>
+
+/* OVERVIEW:
+*
+* A tile grid files the static bodies of a scene (see body_set_kind()) under
+* every square cell of a fixed size their bounding box covers. Levels are
+* built from blocks laid out on a regular grid, so most blocks cover a cell or
+* two, and finding the solids around a body only means looking at the few
+* cells its box covers, however many solids the level has. Only the cells
+* that have something in them take up memory, so the grid has no bounds.
+*
+* Static bodies never move, so each one is filed once, when it is added.
+*/
+
+typedef struct tile_grid tile_grid_t;
+
+
+// Allocates memory for an empty tile grid with cells of the given size.
+tile_grid_t *tile_grid_init(double cell_size);
+
+
+// Releases the memory allocated for a tile grid. Does not free the bodies.
+void tile_grid_free(tile_grid_t *grid);
+
+
+// Files a static body under the cells its bounding box covers.
+void tile_grid_add(tile_grid_t *grid, body_t *body);
+
+
+// Takes a body out of the grid. Must be called before the body is freed.
+void tile_grid_remove(tile_grid_t *grid, body_t *body);
+
+
+// Replaces the contents of found with every body in the grid whose bounding
+// box overlaps the given box, each listed once.
+void tile_grid_query(tile_grid_t *grid, extrema_t box, list_t *found);
+
+
+// Gets the number of bodies in the grid.
+size_t tile_grid_size(tile_grid_t *grid);
+
+
+#endif // #ifndef __TILE_GRID_H__
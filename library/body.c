@@ -1,9 +1,14 @@
 #include "body.h"
+#include "memory.h"
 
 
 const int FORCES_SIZE = 10;
 const int IMPULSES_SIZE = 10;
 const vector_t LIMIT = {150, 500};
+// The contacts of a body are resolved in at most this many passes over them.
+const size_t RESOLVE_ITERATIONS = 4;
+// A contact is satisfied once the body is less than this far from getting out.
+const double RESOLVE_TOLERANCE = 1e-6;
 
 // Functions associated with gameplay  -------------------------------------------------
 
@@ -11,12 +16,9 @@ const vector_t LIMIT = {150, 500};
 // normal force between objects.
 vector_t normal_force(body_t* body, vector_t v)
 {
-    if (body_get_info(body) != NULL)
-    {
-        contact_t contact = sprite_contact((sprite_t*) body_get_info(body));
-        if (contact.left || contact.right) {v.x = 0;}
-        if (contact.below || (contact.above && v.y > 0)) {v.y = 0;}
-    }
+    contact_t contact = body_get_contact(body);
+    if (contact.left || contact.right) {v.x = 0;}
+    if (contact.below || (contact.above && v.y > 0)) {v.y = 0;}
     return v;
 }
 
@@ -35,6 +37,14 @@ vector_t limit_velocity(vector_t v)
 // ----------------------------------------------------------------------------------------
 
 
+// Something solid a body runs into (see body_add_contact()).
+typedef struct body_contact
+{
+    vector_t normal;
+    double depth;
+} body_contact_t;
+
+
 typedef struct body
 {
     // Intrinsic properties of the object ------------------------------
@@ -52,21 +62,42 @@ typedef struct body
 
     // Marks the body for removal; initially false.
     bool remove;
+    // The body is added to this list when it is marked for removal, or NULL.
+    list_t *remove_list;
     vector_t a;
     vector_t v;
     double dxn;
     vector_t forces;
     vector_t impulses;
+    // The centroid at the start of the current tick, used to draw the body
+    // between ticks.
+    vector_t previous;
+    // The interactions of the scene the body takes part in. Does not own them.
+    list_t *interactions;
+    body_kind_t kind;
+    // Asleep bodies are left alone by the scene until they are woken up.
+    bool asleep;
+    // What the body ran into since its contacts were last resolved, and the
+    // sides it touched them on.
+    body_contact_t contacts[BODY_MAX_CONTACTS];
+    size_t num_contacts;
+    contact_t touching;
+    // The sides touching something as of the last resolution.
+    contact_t contact;
 } body_t;
 
 
+// Spawning a fireball or powerup reuses a body freed earlier in the level.
+pool_t BODY_POOL = POOL_INIT("body", body_t);
+
+
 // Allocates memory for a body with the given parameters. The body is initially at rest.
 body_t *body_init(shape_t *shape, double mass, rgb_color_t color)
 {
     assert(mass > 0);
 
     // Allocate memory for the new object.
-    body_t *body = malloc(sizeof(body_t));
+    body_t *body = pool_alloc(&BODY_POOL);
     assert(body != NULL);
     assert(shape != NULL);
 
@@ -76,6 +107,12 @@ body_t *body_init(shape_t *shape, double mass, rgb_color_t color)
     body -> color = color;
 
     body -> remove = false;
+    body -> remove_list = NULL;
+    body -> kind = BODY_DYNAMIC;
+    body -> asleep = false;
+    body -> num_contacts = 0;
+    body -> touching = (contact_t) {false, false, false, false};
+    body -> contact = body -> touching;
 
     // The body is initially at rest.
     body -> v = VEC_ZERO;
@@ -83,9 +120,12 @@ body_t *body_init(shape_t *shape, double mass, rgb_color_t color)
 
     // The body's orientation only changes when body_rotate is called.
     body -> dxn = 0;
+    body -> theta = 0;
 
     body -> forces = VEC_ZERO;
     body -> impulses = VEC_ZERO;
+    body -> previous = shape_centroid(shape);
+    body -> interactions = list_init(FORCES_SIZE, NULL);
 
     body -> info_freer = NULL;
     body -> info = NULL;
@@ -111,12 +151,13 @@ body_t *body_init_with_info(shape_t *shape, double mass, rgb_color_t color, void
 void body_free(body_t *body)
 {
     shape_free(body -> shape);
+    list_free(body -> interactions);
     if (body -> info != NULL && body -> info_freer != NULL)
     {
         (body -> info_freer)(body -> info);
     }
 
-    free(body);
+    pool_free(&BODY_POOL, body);
 }
 
 
@@ -127,12 +168,42 @@ bool body_is_removed(body_t *body)
 }
 
 
+// Gets how the body moves.
+body_kind_t body_get_kind(body_t *body)
+{
+    return body -> kind;
+}
+
+
+// Returns whether the body never moves.
+bool body_is_static(body_t *body)
+{
+    return body -> kind == BODY_STATIC;
+}
+
+
+// Returns whether the body is asleep.
+bool body_is_asleep(body_t *body)
+{
+    return body -> asleep;
+}
+
+
 // Updates the body after a given time interval has elapsed.
 void body_tick(body_t *body, double dt)
 {
+    if (body -> kind == BODY_STATIC) {return;}
     // Animation stuff for the sprite...
     sprite_tick((sprite_t*) body -> info, dt);
 
+    if (body -> kind == BODY_KINEMATIC)
+    {
+        body -> forces = VEC_ZERO;
+        body -> impulses = VEC_ZERO;
+        shape_translate(body -> shape, vec_multiply(dt, body -> v));
+        return;
+    }
+
     // Handling forces...
     vector_t net_force = body -> forces;
     body -> forces = (vector_t) {0, 0};
@@ -168,13 +239,42 @@ void body_tick(body_t *body, double dt)
 // If the body is already marked for removal, does nothing.
 void body_remove(body_t *body)
 {
+    if (body -> remove) {return;}
     body -> remove = true;
+    if (body -> remove_list != NULL) {list_add(body -> remove_list, body);}
+}
+
+
+// Sets the list the body is added to when it is marked for removal.
+void body_set_remove_list(body_t *body, list_t *list)
+{
+    body -> remove_list = list;
 }
 
 
 // Set functions -----------------------------------------------
 
 
+// Sets how the body moves.
+void body_set_kind(body_t *body, body_kind_t kind)
+{
+    body -> kind = kind;
+}
+
+
+// Puts a body to sleep or wakes it up. Anything pushed onto the body in
+// between is dropped, so it picks up exactly where it was left.
+void body_set_asleep(body_t *body, bool asleep)
+{
+    if (body -> asleep == asleep) {return;}
+    body -> asleep = asleep;
+    body -> forces = VEC_ZERO;
+    body -> impulses = VEC_ZERO;
+    body -> num_contacts = 0;
+    body -> touching = (contact_t) {false, false, false, false};
+}
+
+
 void body_set_shape(body_t* body, shape_t* shape)
 {
     shape_t* old = body -> shape;
@@ -189,6 +289,8 @@ void body_set_centroid(body_t *body, vector_t x)
     // The translation vector to move the polygon to the new position.
     vector_t shift = vec_subtract(x, s);
     shape_translate(body -> shape, shift);
+    // Teleports are not interpolated.
+    body -> previous = x;
 }
 
 
@@ -254,19 +356,14 @@ shape_t* body_get_shape(body_t *body)
     {
         return shape_init_circle(shape_centroid(shape), shape_radius(shape));
     }
+    else if (shape_type(shape) == BOX)
+    {
+        extrema_t box = shape_get_extrema(shape);
+        return shape_init_rectangle((vector_t) {box.min_x, box.min_y}, (vector_t) {box.max_x, box.max_y});
+    }
     else // if (shape_type(shape) == POLYGON)
     {
-        size_t size = list_size(shape_vertices(shape));
-        list_t* vertices = list_init(size, free);
-        // Just vectors are added, so only the free function needs to be passed.
-        list_t* old_vertices = shape_vertices(shape);
-        for (size_t i = 0; i < size; i ++)
-        {
-            vector_t *vertex = malloc(sizeof(vector_t));
-            *vertex = *(vector_t*) list_get(old_vertices, i);
-            list_add(vertices, vertex);
-        }
-        copy = shape_init_polygon(vertices);
+        copy = shape_init_polygon(shape_vertices(shape), shape_num_vertices(shape));
     }
     // Make sure a copy was actually created.
     assert(copy != NULL);
@@ -274,6 +371,21 @@ shape_t* body_get_shape(body_t *body)
 }
 
 
+// Gets the shape of a body itself, without copying it.
+shape_t* body_shape(body_t *body)
+{
+    assert(body -> shape != NULL);
+    return body -> shape;
+}
+
+
+// Gets the bounding box of a body without copying its shape.
+extrema_t body_get_extrema(body_t *body)
+{
+    return shape_get_extrema(body -> shape);
+}
+
+
 // Gets the current center of a body.
 vector_t body_get_centroid(body_t *body)
 {
@@ -334,3 +446,86 @@ void body_translate(body_t *body, vector_t translate)
 {
     shape_translate(body -> shape, translate);
 }
+
+
+// Records something solid the body runs into. Once the body keeps as many
+// contacts as it can, a new one replaces the shallowest if it is deeper.
+void body_add_contact(body_t *body, vector_t normal, double depth, contact_t sides)
+{
+    body -> touching.left = body -> touching.left || sides.left;
+    body -> touching.right = body -> touching.right || sides.right;
+    body -> touching.above = body -> touching.above || sides.above;
+    body -> touching.below = body -> touching.below || sides.below;
+    if (depth <= 0) {return;}
+
+    size_t slot = body -> num_contacts;
+    if (slot == BODY_MAX_CONTACTS)
+    {
+        slot = 0;
+        for (size_t i = 1; i < BODY_MAX_CONTACTS; i ++)
+        {
+            if (body -> contacts[i].depth < body -> contacts[slot].depth) {slot = i;}
+        }
+        if (body -> contacts[slot].depth >= depth) {return;}
+    }
+    else {body -> num_contacts ++;}
+    body -> contacts[slot] = (body_contact_t) {normal, depth};
+}
+
+
+// Pushes the body out of all of its contacts at once. Each pass only moves
+// the body by what a contact still needs after the translation found so far,
+// so contacts that push the same way are not counted twice. Contacts pushing
+// against each other (the body is squeezed) can never all be satisfied, which
+// is why the number of passes is bounded.
+void body_resolve_contacts(body_t *body)
+{
+    vector_t translation = VEC_ZERO;
+    for (size_t pass = 0; pass < RESOLVE_ITERATIONS; pass ++)
+    {
+        bool moved = false;
+        for (size_t i = 0; i < body -> num_contacts; i ++)
+        {
+            body_contact_t contact = body -> contacts[i];
+            double remaining = contact.depth - vec_dot(translation, contact.normal);
+            if (remaining <= RESOLVE_TOLERANCE) {continue;}
+            translation = vec_add(translation, vec_multiply(remaining, contact.normal));
+            moved = true;
+        }
+        if (!moved) {break;}
+    }
+    if (body -> num_contacts > 0) {shape_translate(body -> shape, translation);}
+
+    body -> contact = body -> touching;
+    body -> touching = (contact_t) {false, false, false, false};
+    body -> num_contacts = 0;
+}
+
+
+// Gets which sides of the body are touching something solid.
+contact_t body_get_contact(body_t *body)
+{
+    return body -> contact;
+}
+
+
+// Gets the list of interactions the body takes part in.
+list_t *body_get_interactions(body_t *body)
+{
+    return body -> interactions;
+}
+
+
+// Remembers the current centroid as the start of the next tick.
+void body_save_centroid(body_t *body)
+{
+    body -> previous = shape_centroid(body -> shape);
+}
+
+
+// Gets the centroid a fraction alpha of the way through the last tick.
+vector_t body_get_interpolated_centroid(body_t *body, double alpha)
+{
+    vector_t current = shape_centroid(body -> shape);
+    return vec_add(body -> previous, vec_multiply(alpha, vec_subtract(current, body -> previous)));
+}
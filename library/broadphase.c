@@ -0,0 +1,216 @@
+#include "broadphase.h"
+#include "memory.h"
+
+#include <assert.h>
+#include <string.h>
+
+// Bounding boxes are grown by this much on every side, so pairs that come into
+// contact while the tick is being processed are still reported.
+const double BROADPHASE_MARGIN = 2;
+
+// A body tracked by the broad phase, along with its bounding box as of the
+// last update.
+typedef struct proxy
+{
+    body_t *body;
+    extrema_t box;
+    // Static bodies never move, so their box is never updated, and two of them
+    // are never reported as a pair. The same goes for asleep bodies while they
+    // stay asleep.
+    bool fixed;
+    bool asleep;
+} proxy_t;
+
+
+// Definition of the broadphase struct. Both arrays are reused from tick to
+// tick, so a steady-state update does not allocate.
+typedef struct broadphase
+{
+    // Proxies sorted by box.min_x.
+    proxy_t *proxies;
+    size_t size;
+    size_t capacity;
+
+    body_pair_t *pairs;
+    size_t num_pairs;
+    size_t pairs_capacity;
+} broadphase_t;
+
+
+// Gets the bounding box of a body, grown by BROADPHASE_MARGIN.
+extrema_t broadphase_box(body_t *body)
+{
+    extrema_t box = body_get_extrema(body);
+    return (extrema_t) {box.min_x - BROADPHASE_MARGIN, box.max_x + BROADPHASE_MARGIN,
+        box.min_y - BROADPHASE_MARGIN, box.max_y + BROADPHASE_MARGIN};
+}
+
+
+// Allocates memory for an empty broad phase.
+broadphase_t *broadphase_init(size_t initial_size)
+{
+    broadphase_t *broadphase = mem_alloc(sizeof(broadphase_t));
+    assert(broadphase != NULL);
+    if (initial_size == 0) {initial_size = 1;}
+
+    broadphase -> proxies = mem_alloc(initial_size * sizeof(proxy_t));
+    broadphase -> size = 0;
+    broadphase -> capacity = initial_size;
+
+    broadphase -> pairs = mem_alloc(initial_size * sizeof(body_pair_t));
+    broadphase -> num_pairs = 0;
+    broadphase -> pairs_capacity = initial_size;
+    assert(broadphase -> proxies != NULL && broadphase -> pairs != NULL);
+
+    return broadphase;
+}
+
+
+// Releases the memory allocated for a broad phase.
+void broadphase_free(broadphase_t *broadphase)
+{
+    mem_free(broadphase -> proxies);
+    mem_free(broadphase -> pairs);
+    mem_free(broadphase);
+}
+
+
+// Starts tracking a body. It is appended at the end and moved into place by
+// the next update.
+void broadphase_add(broadphase_t *broadphase, body_t *body)
+{
+    if (broadphase -> size == broadphase -> capacity)
+    {
+        broadphase -> capacity *= 2;
+        broadphase -> proxies = mem_realloc(broadphase -> proxies, broadphase -> capacity * sizeof(proxy_t));
+        assert(broadphase -> proxies != NULL);
+    }
+    broadphase -> proxies[broadphase -> size] = (proxy_t) {body, broadphase_box(body), body_is_static(body), false};
+    broadphase -> size ++;
+}
+
+
+// Stops tracking a body, keeping the remaining proxies in order.
+void broadphase_remove(broadphase_t *broadphase, body_t *body)
+{
+    for (size_t i = 0; i < broadphase -> size; i ++)
+    {
+        if (broadphase -> proxies[i].body != body) {continue;}
+
+        memmove(&broadphase -> proxies[i], &broadphase -> proxies[i + 1],
+            (broadphase -> size - i - 1) * sizeof(proxy_t));
+        broadphase -> size --;
+        break;
+    }
+
+    // Drop any pair from the last update that refers to the body.
+    size_t kept = 0;
+    for (size_t i = 0; i < broadphase -> num_pairs; i ++)
+    {
+        body_pair_t pair = broadphase -> pairs[i];
+        if (pair.body1 == body || pair.body2 == body) {continue;}
+        broadphase -> pairs[kept] = pair;
+        kept ++;
+    }
+    broadphase -> num_pairs = kept;
+}
+
+
+// Stops tracking every body marked for removal, keeping the remaining proxies
+// in order.
+void broadphase_remove_marked(broadphase_t *broadphase)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < broadphase -> size; i ++)
+    {
+        if (body_is_removed(broadphase -> proxies[i].body)) {continue;}
+        broadphase -> proxies[kept] = broadphase -> proxies[i];
+        kept ++;
+    }
+    broadphase -> size = kept;
+
+    kept = 0;
+    for (size_t i = 0; i < broadphase -> num_pairs; i ++)
+    {
+        body_pair_t pair = broadphase -> pairs[i];
+        if (body_is_removed(pair.body1) || body_is_removed(pair.body2)) {continue;}
+        broadphase -> pairs[kept] = pair;
+        kept ++;
+    }
+    broadphase -> num_pairs = kept;
+}
+
+
+// Records an overlapping pair.
+void broadphase_add_pair(broadphase_t *broadphase, body_t *body1, body_t *body2)
+{
+    if (broadphase -> num_pairs == broadphase -> pairs_capacity)
+    {
+        broadphase -> pairs_capacity *= 2;
+        broadphase -> pairs = mem_realloc(broadphase -> pairs, broadphase -> pairs_capacity * sizeof(body_pair_t));
+        assert(broadphase -> pairs != NULL);
+    }
+    broadphase -> pairs[broadphase -> num_pairs] = (body_pair_t) {body1, body2};
+    broadphase -> num_pairs ++;
+}
+
+
+// Re-sorts the bodies by their current bounding boxes and collects every pair
+// of bodies whose bounding boxes overlap.
+void broadphase_update(broadphase_t *broadphase)
+{
+    proxy_t *proxies = broadphase -> proxies;
+    size_t size = broadphase -> size;
+
+    // Refresh the boxes and repair the order with an insertion sort, which is
+    // nearly linear since bodies barely move between ticks.
+    for (size_t i = 0; i < size; i ++)
+    {
+        proxy_t proxy = proxies[i];
+        if (!proxy.fixed)
+        {
+            // A body that just fell asleep may have moved during its last tick.
+            bool was_asleep = proxy.asleep;
+            proxy.asleep = body_is_asleep(proxy.body);
+            if (!was_asleep || !proxy.asleep) {proxy.box = broadphase_box(proxy.body);}
+        }
+        size_t j = i;
+        while (j > 0 && proxies[j - 1].box.min_x > proxy.box.min_x)
+        {
+            proxies[j] = proxies[j - 1];
+            j --;
+        }
+        proxies[j] = proxy;
+    }
+
+    // Sweep: each box is only compared against the boxes that start before
+    // it ends along x.
+    broadphase -> num_pairs = 0;
+    for (size_t i = 0; i < size; i ++)
+    {
+        extrema_t box = proxies[i].box;
+        bool idle = proxies[i].fixed || proxies[i].asleep;
+        for (size_t j = i + 1; j < size && proxies[j].box.min_x <= box.max_x; j ++)
+        {
+            if (idle && (proxies[j].fixed || proxies[j].asleep)) {continue;}
+            extrema_t other = proxies[j].box;
+            if (other.min_y > box.max_y || box.min_y > other.max_y) {continue;}
+            broadphase_add_pair(broadphase, proxies[i].body, proxies[j].body);
+        }
+    }
+}
+
+
+// Gets the number of overlapping pairs found by the last update.
+size_t broadphase_num_pairs(broadphase_t *broadphase)
+{
+    return broadphase -> num_pairs;
+}
+
+
+// Gets an overlapping pair found by the last update.
+body_pair_t broadphase_get_pair(broadphase_t *broadphase, size_t index)
+{
+    assert(index < broadphase -> num_pairs);
+    return broadphase -> pairs[index];
+}
@@ -28,7 +28,7 @@ double get_overlap(vector_t v1, vector_t v2)
 
 
 // If objects are close then return true.
-bool collision_possible(shape_t *shape1, shape_t *shape2, collision_info_t info)
+bool collision_possible(shape_t *shape1, shape_t *shape2, collision_info_t *info)
 {
     // Checks if they overlap on x-axis and y-axis
     // vector_t s1 = shape_centroid(shape1);
@@ -48,7 +48,7 @@ bool collision_possible(shape_t *shape1, shape_t *shape2, collision_info_t info)
         // If they overlap on both axes then they are probably close.
         // IT has to be both because if they don't overlap on one than SAT thoerem
         // already states that no collision is happening
-        info.overlap_v = (vector_t) {overlap1, overlap2};
+        info -> overlap_v = (vector_t) {overlap1, overlap2};
         return true;
     }
     return false;
@@ -59,14 +59,15 @@ bool collision_possible(shape_t *shape1, shape_t *shape2, collision_info_t info)
 // the axis which form the largest "shadow" of the shape.
 vector_t shape_project(shape_t *shape, vector_t axis)
 {
-    list_t* vertices = shape_vertices(shape);
+    vector_t* vertices = shape_vertices(shape);
+    size_t size = shape_num_vertices(shape);
 
-    double min = vec_dot(axis, *(vector_t*) list_get(vertices, 0));
-    double max = vec_dot(axis, *(vector_t*) list_get(vertices, 0));
+    double min = vec_dot(axis, vertices[0]);
+    double max = min;
 
-    for (size_t i = 0; i < list_size(vertices); i++)
+    for (size_t i = 1; i < size; i++)
     {
-        double p = vec_dot(axis, *(vector_t*) list_get(vertices, i));
+        double p = vec_dot(axis, vertices[i]);
 
         if (p < min) {min = p;}
         if (p > max) {max = p;}
@@ -77,60 +78,270 @@ vector_t shape_project(shape_t *shape, vector_t axis)
 
 
 
-// Returns the axis along which the objects have collided and whether or not
-// the two objects have collided (contained by collision_info_t).
-collision_info_t find_collision(body_t *body1, body_t *body2)
+// Collides two axis-aligned boxes using only their extrema. The boxes collide if
+// they overlap along both x and y, and they are pushed apart along whichever of
+// the two has the smaller overlap (y on ties, as with the SAT normals).
+collision_info_t find_box_collision(shape_t *shape1, shape_t *shape2)
 {
-    shape_t* shape1 = body_get_shape(body1);
-    shape_t* shape2 = body_get_shape(body2);
+    collision_info_t info = {false, VEC_ZERO, INFINITY, VEC_ZERO};
+    if (!collision_possible(shape1, shape2, &info)) {return info;}
 
-    collision_info_t info;
     info.collided = true;
+    vector_t c1 = shape_centroid(shape1);
+    vector_t c2 = shape_centroid(shape2);
+    if (info.overlap_v.y <= info.overlap_v.x)
+    {
+        info.axis = (vector_t) {0, (c2.y >= c1.y) ? 1 : -1};
+        info.overlap = info.overlap_v.y;
+    }
+    else
+    {
+        info.axis = (vector_t) {(c2.x >= c1.x) ? 1 : -1, 0};
+        info.overlap = info.overlap_v.x;
+    }
+    return info;
+}
 
-    // Preliminary check to see if a collision is likely.
-    if (!collision_possible(shape1, shape2, info))
+
+// Returns the same collision seen from the other shape, i.e. with the axis
+// pointing the other way.
+collision_info_t collision_flip(collision_info_t info)
+{
+    info.axis = vec_negate(info.axis);
+    return info;
+}
+
+
+// Finds the part of a sweep along one axis during which two intervals overlap,
+// narrowing [entry, exit] down to it. Returns false if they never overlap.
+bool sweep_axis(double min1, double max1, double d, double min2, double max2, double *entry, double *exit)
+{
+    if (d == 0)
     {
-        info.collided = false;
-        shape_free(shape1);
-        shape_free(shape2);
+        // Never moves along the axis, so it overlaps all the time or never.
+        return max1 > min2 && max2 > min1;
+    }
+    double t1 = (min2 - max1) / d;
+    double t2 = (max2 - min1) / d;
+    if (t1 > t2) {double t = t1; t1 = t2; t2 = t;}
+    if (t1 > *entry) {*entry = t1;}
+    if (t2 < *exit) {*exit = t2;}
+    return true;
+}
+
+
+// Sweeps a box against a box that stays put (slab method). The boxes touch
+// once they overlap along both x and y, i.e. at the later of the two times they
+// start overlapping along each.
+double find_time_of_impact(extrema_t moving, vector_t displacement, extrema_t target, vector_t *axis)
+{
+    double entry_x = -INFINITY;
+    double exit_x = INFINITY;
+    double entry_y = -INFINITY;
+    double exit_y = INFINITY;
+    if (!sweep_axis(moving.min_x, moving.max_x, displacement.x, target.min_x, target.max_x, &entry_x, &exit_x)) {return -1;}
+    if (!sweep_axis(moving.min_y, moving.max_y, displacement.y, target.min_y, target.max_y, &entry_y, &exit_y)) {return -1;}
+
+    double entry = fmax(entry_x, entry_y);
+    double exit = fmin(exit_x, exit_y);
+    if (entry > exit || entry < 0 || entry > 1) {return -1;}
+
+    if (entry_x > entry_y) {*axis = (vector_t) {displacement.x > 0 ? 1 : -1, 0};}
+    else {*axis = (vector_t) {0, displacement.y > 0 ? 1 : -1};}
+    return entry;
+}
+
+
+// Collides two circles using their centroids and radii.
+collision_info_t find_circle_collision(shape_t *circle1, shape_t *circle2)
+{
+    collision_info_t info = {false, VEC_ZERO, INFINITY, VEC_ZERO};
+    if (!collision_possible(circle1, circle2, &info)) {return info;}
+
+    vector_t d = vec_subtract(shape_centroid(circle2), shape_centroid(circle1));
+    double distance = vec_magnitude(d);
+    double overlap = shape_radius(circle1) + shape_radius(circle2) - distance;
+    if (overlap <= 0) {return info;}
+
+    info.collided = true;
+    info.overlap = overlap;
+    // Concentric circles can be pushed apart in any direction.
+    info.axis = (distance > 0) ? vec_multiply(1 / distance, d) : (vector_t) {0, 1};
+    return info;
+}
+
+
+// Collides a circle with a BOX by finding the point of the box closest to the
+// circle's centroid.
+collision_info_t find_circle_box_collision(shape_t *circle, shape_t *box)
+{
+    collision_info_t info = {false, VEC_ZERO, INFINITY, VEC_ZERO};
+    if (!collision_possible(circle, box, &info)) {return info;}
+
+    vector_t c = shape_centroid(circle);
+    double r = shape_radius(circle);
+    extrema_t e = shape_get_extrema(box);
+    vector_t closest = {fmin(fmax(c.x, e.min_x), e.max_x), fmin(fmax(c.y, e.min_y), e.max_y)};
+    vector_t d = vec_subtract(closest, c);
+    double distance = vec_magnitude(d);
+
+    if (distance > 0)
+    {
+        // The centroid is outside the box.
+        if (distance >= r) {return info;}
+        info.collided = true;
+        info.overlap = r - distance;
+        info.axis = vec_multiply(1 / distance, d);
         return info;
     }
 
-    // Initialize min_overlap.
-    double overlap = INFINITY;
+    // The centroid is inside the box, so push the circle out through the
+    // nearest side (y on ties, as with boxes).
+    double left = c.x - e.min_x;
+    double right = e.max_x - c.x;
+    double below = c.y - e.min_y;
+    double above = e.max_y - c.y;
+    double min_x = fmin(left, right);
+    double min_y = fmin(below, above);
+    info.collided = true;
+    if (min_y <= min_x)
+    {
+        info.overlap = r + min_y;
+        info.axis = (vector_t) {0, (below <= above) ? 1 : -1};
+    }
+    else
+    {
+        info.overlap = r + min_x;
+        info.axis = (vector_t) {(left <= right) ? 1 : -1, 0};
+    }
+    return info;
+}
+
 
-    list_t *normals = shape_normals(shape1);
+// Collides a circle with a convex polygon by finding the point on the polygon's
+// edges closest to the circle's centroid.
+collision_info_t find_circle_polygon_collision(shape_t *circle, shape_t *polygon)
+{
+    collision_info_t info = {false, VEC_ZERO, INFINITY, VEC_ZERO};
+    if (!collision_possible(circle, polygon, &info)) {return info;}
 
-    list_extend(normals, shape_normals(shape2));
-    
-    size_t size = list_size(normals);
+    vector_t c = shape_centroid(circle);
+    double r = shape_radius(circle);
+    vector_t *vertices = shape_vertices(polygon);
+    size_t size = shape_num_vertices(polygon);
+
+    vector_t closest = c;
+    double min_distance = INFINITY;
+    // The centroid is inside the polygon if it is on the same side of every edge.
+    bool positive = false;
+    bool negative = false;
+    for (size_t i = 0; i < size; i ++)
+    {
+        vector_t v1 = vertices[i];
+        vector_t v2 = vertices[(i + 1) % size];
+        vector_t edge = vec_subtract(v2, v1);
+        vector_t to_c = vec_subtract(c, v1);
+
+        double side = vec_cross(edge, to_c);
+        if (side > 0) {positive = true;}
+        if (side < 0) {negative = true;}
+
+        // Closest point to the centroid on this edge.
+        double t = vec_dot(to_c, edge) / vec_dot(edge, edge);
+        t = fmin(fmax(t, 0), 1);
+        vector_t point = vec_add(v1, vec_multiply(t, edge));
+        double distance = vec_magnitude(vec_subtract(point, c));
+        if (distance < min_distance)
+        {
+            min_distance = distance;
+            closest = point;
+        }
+    }
+    bool inside = !(positive && negative);
+
+    if (!inside && min_distance >= r) {return info;}
+
+    info.collided = true;
+    if (min_distance == 0)
+    {
+        // The centroid is on an edge, so push the circle away from the polygon's center.
+        vector_t d = vec_subtract(shape_centroid(polygon), c);
+        info.overlap = r;
+        info.axis = (vec_magnitude(d) > 0) ? vec_normalize(d) : (vector_t) {0, 1};
+    }
+    else if (inside)
+    {
+        // The circle has to move past the nearest edge.
+        info.overlap = r + min_distance;
+        info.axis = vec_multiply(1 / min_distance, vec_subtract(c, closest));
+    }
+    else
+    {
+        info.overlap = r - min_distance;
+        info.axis = vec_multiply(1 / min_distance, vec_subtract(closest, c));
+    }
+    return info;
+}
+
+
+// Projects both shapes onto each of the axes, keeping the axis with the smallest
+// overlap in info. Returns false as soon as the shapes do not overlap on an axis.
+bool find_min_overlap(shape_t *shape1, shape_t *shape2, vector_t *axes, size_t size, collision_info_t *info)
+{
     for (size_t i = 0; i < size; i++)
     {
+        vector_t axis = axes[i];
         // Project each shape onto a normal vector.
-        vector_t v1 = shape_project(shape1, *(vector_t*) list_get(normals, i));
-        vector_t v2 = shape_project(shape2, *(vector_t*) list_get(normals, i));
+        double curr_overlap = get_overlap(shape_project(shape1, axis), shape_project(shape2, axis));
 
-        if (get_overlap(v1, v2) < 0)
+        if (curr_overlap < 0)
         {
             // If there is one case of no overlap then the objects don't overlap
             // This is due to SAT theorem
-            info.collided = false;
-            break;        
+            return false;
         }
-
-        double curr_overlap = get_overlap(v1, v2);
-        if (curr_overlap < overlap)
+        if (curr_overlap < info -> overlap)
         {
-            overlap = curr_overlap;
-            info.axis = *(vector_t*) list_get(normals, i);
-            // adjusting verticies to get rid of really small numbers like -1e8 and 1e8
-            info.overlap = overlap;
+            info -> axis = axis;
+            info -> overlap = curr_overlap;
         }
     }
-   
-    list_free(normals);
-    shape_free(shape1);
-    shape_free(shape2);
+    return true;
+}
+
+
+// Returns the axis along which the objects have collided and whether or not
+// the two objects have collided (contained by collision_info_t).
+// The shapes are read in place and their normals are cached, so nothing is
+// allocated.
+collision_info_t find_collision(body_t *body1, body_t *body2)
+{
+    shape_t* shape1 = body_shape(body1);
+    shape_t* shape2 = body_shape(body2);
+
+    int type1 = shape_type(shape1);
+    int type2 = shape_type(shape2);
+    if (type1 == BOX && type2 == BOX) {return find_box_collision(shape1, shape2);}
+
+    // Circles are never tested against vertices.
+    if (type1 == CIRCLE && type2 == CIRCLE) {return find_circle_collision(shape1, shape2);}
+    if (type1 == CIRCLE && type2 == BOX) {return find_circle_box_collision(shape1, shape2);}
+    if (type1 == BOX && type2 == CIRCLE) {return collision_flip(find_circle_box_collision(shape2, shape1));}
+    if (type1 == CIRCLE) {return find_circle_polygon_collision(shape1, shape2);}
+    if (type2 == CIRCLE) {return collision_flip(find_circle_polygon_collision(shape2, shape1));}
+
+    collision_info_t info;
+    info.collided = false;
+    info.axis = VEC_ZERO;
+    info.overlap = INFINITY;
+    info.overlap_v = VEC_ZERO;
+
+    // Preliminary check to see if a collision is likely.
+    if (!collision_possible(shape1, shape2, &info)) {return info;}
+
+    // Check the normals of both shapes.
+    info.collided = find_min_overlap(shape1, shape2, shape_get_normals(shape1), shape_num_vertices(shape1), &info)
+        && find_min_overlap(shape1, shape2, shape_get_normals(shape2), shape_num_vertices(shape2), &info);
 
     return info;
 }
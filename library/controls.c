@@ -28,7 +28,7 @@ void player_idle(body_t* body)
 void player_jump(body_t *body)
 {
     sprite_t *player = (sprite_t*) (body_get_info(body));
-    contact_t contact = sprite_contact(player);
+    contact_t contact = body_get_contact(body);
 
     // Only proceed if touching
     if (!contact.below) {return;}
@@ -44,7 +44,7 @@ void player_jump(body_t *body)
 void player_downpound(body_t* body)
 {
     sprite_t *player = (sprite_t*) (body_get_info(body));
-    contact_t contact = sprite_contact(player);
+    contact_t contact = body_get_contact(body);
     // You can only ground pound if your in the air
 
     vector_t v = body_get_velocity(body);
@@ -62,7 +62,7 @@ void player_downpound(body_t* body)
 void player_move(body_t *body, double direction)
 {
     sprite_t *sprite = (sprite_t*) (body_get_info(body));
-    contact_t contact = sprite_contact(sprite);
+    contact_t contact = body_get_contact(body);
 
     // Immobilizes players due to an enemy collision
     if(sprite_is_immobilized(sprite) != 0) {return;}
@@ -0,0 +1,105 @@
+#include "dispatch.h"
+#include "memory.h"
+
+#include <assert.h>
+
+
+// A registered handler, along with the subroles of the two bodies it applies
+// to.
+typedef struct dispatch_entry
+{
+    subrole_t subrole1;
+    subrole_t subrole2;
+    force_creator_t handler;
+    void *aux;
+} dispatch_entry_t;
+
+
+// Definition of the dispatch struct.
+typedef struct dispatch
+{
+    // The entries registered for each ordered pair of roles, at index
+    // role1 * NUM_ROLES + role2.
+    list_t *by_roles;
+} dispatch_t;
+
+
+// Allocates memory for an empty dispatch table.
+dispatch_t *dispatch_init(void)
+{
+    dispatch_t *dispatch = mem_alloc(sizeof(dispatch_t));
+    assert(dispatch != NULL);
+    dispatch -> by_roles = list_init(NUM_ROLES * NUM_ROLES, (free_func_t) list_free);
+    for (size_t i = 0; i < NUM_ROLES * NUM_ROLES; i ++)
+    {
+        list_add(dispatch -> by_roles, list_init(1, mem_free));
+    }
+    return dispatch;
+}
+
+
+// Releases the memory allocated for a dispatch table.
+void dispatch_free(dispatch_t *dispatch)
+{
+    list_free(dispatch -> by_roles);
+    mem_free(dispatch);
+}
+
+
+// Gets the entries registered for an ordered pair of roles.
+list_t *dispatch_entries(dispatch_t *dispatch, role_t role1, role_t role2)
+{
+    assert(role1 < NUM_ROLES && role2 < NUM_ROLES);
+    return list_get(dispatch -> by_roles, role1 * NUM_ROLES + role2);
+}
+
+
+// Registers a handler between two types of bodies.
+void dispatch_add(dispatch_t *dispatch, role_t role1, subrole_t subrole1, role_t role2, subrole_t subrole2,
+    force_creator_t handler, void *aux)
+{
+    assert(handler != NULL);
+    dispatch_entry_t *entry = mem_alloc(sizeof(dispatch_entry_t));
+    assert(entry != NULL);
+    *entry = (dispatch_entry_t) {subrole1, subrole2, handler, aux};
+    list_add(dispatch_entries(dispatch, role1, role2), entry);
+}
+
+
+// Returns whether a registered subrole matches the subrole of a body.
+bool dispatch_subrole_matches(subrole_t registered, subrole_t subrole)
+{
+    return registered == DISPATCH_ANY_SUBROLE || registered == subrole;
+}
+
+
+// Appends the entries registered for the types of two bodies, in that order,
+// to matches.
+size_t dispatch_collect(dispatch_t *dispatch, sprite_t *sprite1, sprite_t *sprite2, bool swapped,
+    dispatch_match_t *matches, size_t found, size_t max)
+{
+    list_t *entries = dispatch_entries(dispatch, sprite_role(sprite1), sprite_role(sprite2));
+    size_t size = list_size(entries);
+    for (size_t i = 0; i < size && found < max; i ++)
+    {
+        dispatch_entry_t *entry = list_get(entries, i);
+        if (!dispatch_subrole_matches(entry -> subrole1, sprite_subrole(sprite1))
+            || !dispatch_subrole_matches(entry -> subrole2, sprite_subrole(sprite2))) {continue;}
+        matches[found] = (dispatch_match_t) {entry -> handler, entry -> aux, swapped};
+        found ++;
+    }
+    return found;
+}
+
+
+// Finds the handlers registered between the types of two bodies. Handlers
+// registered for the bodies in the opposite order are found too.
+size_t dispatch_find(dispatch_t *dispatch, body_t *body1, body_t *body2, dispatch_match_t *matches, size_t max)
+{
+    sprite_t *sprite1 = body_get_info(body1);
+    sprite_t *sprite2 = body_get_info(body2);
+    if (sprite1 == NULL || sprite2 == NULL) {return 0;}
+
+    size_t found = dispatch_collect(dispatch, sprite1, sprite2, false, matches, 0, max);
+    return dispatch_collect(dispatch, sprite2, sprite1, true, matches, found, max);
+}
@@ -8,25 +8,26 @@ const double RADIUS_BARRIER = 30;
 
 // Adds a force creator to a scene that calls a given collision handler function each time two bodies collide.
 // This generalizes create_destructive_collision() from last week, allowing different things to happen on a collision.
-// It should only be called once while the bodies are still colliding.
+// The handler is only run while the bodies are close, and reads whether they touch
+// from interaction_get_event().
 void create_collision(scene_t *scene, body_t *body1, body_t *body2, force_creator_t handler, void *aux, free_func_t freer)
 {
     list_t* bodies = list_init(2, (free_func_t) body_free);
     list_add(bodies, body1);
     list_add(bodies, body2);
 
-    scene_add_bodies_force_creator(scene, handler, aux, bodies, freer);
+    scene_add_collision_force_creator(scene, handler, aux, bodies, freer);
 }
 
 
 // Adds a collision_handler_t to a scene which applies an elastic collision interaction between two bodies.
 void create_physics_collision(scene_t* scene, body_t* body1, body_t* body2, double e)
 {
-    double *aux = malloc(sizeof(double));
+    double *aux = mem_alloc(sizeof(double));
     assert(aux != NULL);
     *aux = e;
 
-    create_collision(scene, body1, body2, physics_collision, aux, free);
+    create_collision(scene, body1, body2, physics_collision, aux, mem_free);
 }
 
 
@@ -48,7 +49,7 @@ void destructive_collision(interaction_t* interaction)
     body_t *body2 = interaction_get_body(interaction, 1);
 
     // Check if the two bodies have collided.
-    if (find_collision(body1, body2).collided)
+    if (interaction_is_touching(interaction))
     {
         // If there is a collision, mark the two bodies for removal.
         body_remove(body1);
@@ -68,25 +69,9 @@ void physics_collision(interaction_t* interaction)
     // Get the elasticicity.
     double k = *(double*) interaction_get_aux(interaction);
 
-    collision_info_t collision = find_collision(body1, body2);
-
-    // Sets colliding to false next time interaction is called
-    if (interaction_is_colliding(interaction))
-    {
-        // checking if the two objects are still colliding
-        if(!collision.collided)
-        {
-        interaction_set_colliding(interaction, false);
-        }
-        return;
-    }
-    else
-    {
-    // If there is no collision, return.
-    if (!collision.collided)
-    {
-        return;
-    }
+    // The impulse is only applied once, when the bodies first touch.
+    if (interaction_get_event(interaction) != CONTACT_BEGIN) {return;}
+    collision_info_t collision = interaction_get_collision(interaction);
 
     double m_reduced;
     double m1 = body_get_mass(body1);
@@ -108,9 +93,6 @@ void physics_collision(interaction_t* interaction)
     // Add impulses to both bodies.
     body_add_impulse(body2, impulse);
     body_add_impulse(body1, vec_negate(impulse));
-
-    interaction_set_colliding(interaction, true);
-    }
 }
 
 
@@ -124,10 +106,10 @@ void create_newtonian_gravity(scene_t *scene, double g, body_t *body1, body_t *b
     list_add(bodies, body1);
     list_add(bodies, body2);
 
-    double *aux = malloc(sizeof(double));
+    double *aux = mem_alloc(sizeof(double));
     *aux = g;
 
-    scene_add_bodies_force_creator(scene, (force_creator_t) newtonian_gravity, aux, bodies, (free_func_t) free);
+    scene_add_bodies_force_creator(scene, (force_creator_t) newtonian_gravity, aux, bodies, (free_func_t) mem_free);
 }
 
 
@@ -140,10 +122,10 @@ void create_spring(scene_t *scene, double k, body_t *body1, body_t *body2)
     list_add(bodies, body2);
 
     // aux now stores the constant relevant to the interaction.
-    double *aux = malloc(sizeof(double));
+    double *aux = mem_alloc(sizeof(double));
     *aux = k;
 
-    scene_add_bodies_force_creator(scene, (force_creator_t) spring, aux, bodies, (free_func_t) free);
+    scene_add_bodies_force_creator(scene, (force_creator_t) spring, aux, bodies, (free_func_t) mem_free);
 }
 
 
@@ -155,10 +137,10 @@ void create_drag(scene_t *scene, double gamma, body_t *body)
     list_t *bodies = list_init(2, (free_func_t) body_free);
     list_add(bodies, body);
 
-    double *aux = malloc(sizeof(double));
+    double *aux = mem_alloc(sizeof(double));
     *aux = gamma;
 
-    scene_add_bodies_force_creator(scene, (force_creator_t) drag, aux, bodies, (free_func_t) free);
+    scene_add_bodies_force_creator(scene, (force_creator_t) drag, aux, bodies, (free_func_t) mem_free);
 }
 
 
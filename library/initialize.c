@@ -1,5 +1,6 @@
 #include "initialize.h"
 #include "sprite.h"
+#include "spawner.h"
 
 const double PLAYER_MASS = 10;
 const vector_t PLAYER_SIZE = {25, 28};
@@ -54,6 +55,9 @@ void add_player(scene_t *scene, vector_t position, subrole_t subrole)
 // Used during firemode.....releases a fireball that kills enemies
 void add_fireball(scene_t *scene, vector_t position, vector_t velocity)
 {
+    // Fireballs are added from the key handlers, outside of level_load() and
+    // scene_tick(), so the scene's arena has to be made current here.
+    arena_t *previous = mem_use_arena(scene_get_arena(scene));
     // Initialize a rectangle to back the player sprite.
     shape_t *shape = shape_init_circle(VEC_ZERO, FIREBALL_SIZE);
     sprite_t *sprite = sprite_init(POWERUP, FIREBALL, 1, true);
@@ -66,10 +70,12 @@ void add_fireball(scene_t *scene, vector_t position, vector_t velocity)
     initialize_fireball(scene, body);
     // Add the body to the ENEMY sublist.
     scene_add_body(scene, body, ENEMY);
+    mem_use_arena(previous);
 }
 
 void add_enemy(scene_t *scene, vector_t position, subrole_t subrole)
 {
+    if (spawner_record((spawn_t) {SPAWN_ENEMY, subrole, position, VEC_ZERO, NULL})) {return;}
     // Initialize a circle to back the player sprite.
     shape_t *shape;
     if (subrole == KOOPA) {shape = shape_init_circle(CENTER, KOOPA_SIZE);}
@@ -85,6 +91,7 @@ void add_enemy(scene_t *scene, vector_t position, subrole_t subrole)
 // if only one add_.... doesn't have subrole
 void add_token(scene_t *scene, vector_t position)
 {
+    if (spawner_record((spawn_t) {SPAWN_TOKEN, NO_SUBROLE, position, VEC_ZERO, NULL})) {return;}
     shape_t *shape = shape_init_circle(CENTER, TOKEN_SIZE);
     sprite_t *sprite = sprite_init(TOKEN, NO_SUBROLE, 1, true);
     body_t *body = body_init_with_info(shape, TOKEN_MASS, BLUE, sprite, (free_func_t)sprite_free);
@@ -95,8 +102,9 @@ void add_token(scene_t *scene, vector_t position)
 
 void add_powerup(scene_t *scene, vector_t position, subrole_t subrole)
 {
+    if (spawner_record((spawn_t) {SPAWN_POWERUP, subrole, position, VEC_ZERO, NULL})) {return;}
     // Initialize a circle to back the player sprite.
-    shape_t *shape = shape_init_rectangle(VEC_ZERO, POWERUP_SIZE);
+    shape_t *shape = shape_init_instance(shape_template_box(POWERUP_SIZE), position);
     sprite_t *sprite = sprite_init(POWERUP, subrole, 0, false);
     body_t *body = body_init_with_info(shape, POWERUP_MASS, BLUE, sprite, (free_func_t)sprite_free);
     body_set_centroid(body, position);
@@ -107,12 +115,13 @@ void add_powerup(scene_t *scene, vector_t position, subrole_t subrole)
 
 void add_platform(scene_t *scene, vector_t position, vector_t size, subrole_t subrole, void *info)
 {
-    // Initialize a circle to back the player sprite.
-    shape_t *shape = shape_init_rectangle((vector_t){0, 0}, size);
+    if (spawner_record((spawn_t) {SPAWN_PLATFORM, subrole, position, size, info})) {return;}
+    // Blocks of the same size share their geometry.
+    shape_t *shape = shape_init_instance(shape_template_box(size), position);
     sprite_t *sprite;
     if (info != NULL)
     {
-        sprite = sprite_init_with_info(PLATFORM, subrole, 0, false, info, free);
+        sprite = sprite_init_with_info(PLATFORM, subrole, 0, false, info, mem_free);
     }
     else
     {
@@ -120,15 +129,17 @@ void add_platform(scene_t *scene, vector_t position, vector_t size, subrole_t su
     }
 
     body_t *body = body_init_with_info(shape, PLATFORM_MASS, ORANGE, sprite, (free_func_t)sprite_free);
+    body_set_kind(body, BODY_STATIC);
     body_set_centroid(body, position);
     // Add the body to the PLAYER sublist.
     scene_add_body(scene, body, PLATFORM);
 
     if (subrole == ITEM_BLOCK || subrole == TUNNEL_BLOCK)
     {
-        shape_t *shape = shape_init_rectangle((vector_t){0, 0}, size);
+        shape_t *shape = shape_init_instance(shape_template_box(size), position);
         sprite_t *sprite = sprite_init(PLATFORM, REGULAR_BLOCK, 0, false);
         body_t *body = body_init_with_info(shape, PLATFORM_MASS, ORANGE, sprite, (free_func_t)sprite_free);
+        body_set_kind(body, BODY_STATIC);
         body_set_centroid(body, position);
         // Add the body to the PLAYER sublist.
         scene_add_body(scene, body, PLATFORM);
@@ -137,12 +148,15 @@ void add_platform(scene_t *scene, vector_t position, vector_t size, subrole_t su
 
 void add_platform_corners(scene_t *scene, vector_t p1, vector_t p2, subrole_t subrole, void *info)
 {
-    // Initialize a circle to back the player sprite.
-    shape_t *shape = shape_init_rectangle(p1, p2);
+    if (spawner_record((spawn_t) {SPAWN_PLATFORM_CORNERS, subrole, p1, p2, info})) {return;}
+    vector_t size = vec_subtract(p2, p1);
+    vector_t center = vec_multiply(0.5, vec_add(p1, p2));
+    // Blocks of the same size share their geometry.
+    shape_t *shape = shape_init_instance(shape_template_box(size), center);
     sprite_t *sprite;
     if (info != NULL)
     {
-        sprite = sprite_init_with_info(PLATFORM, subrole, 0, false, info, free);
+        sprite = sprite_init_with_info(PLATFORM, subrole, 0, false, info, mem_free);
     }
     else
     {
@@ -150,14 +164,17 @@ void add_platform_corners(scene_t *scene, vector_t p1, vector_t p2, subrole_t su
     }
 
     body_t *body = body_init_with_info(shape, PLATFORM_MASS, ORANGE, sprite, (free_func_t)sprite_free);
+    body_set_kind(body, BODY_STATIC);
     // Add the body to the PLAYER sublist.
     scene_add_body(scene, body, PLATFORM);
 
     if (subrole == ITEM_BLOCK || subrole == TUNNEL_BLOCK)
     {
-        shape_t *shape = shape_init_rectangle((vector_t) {p1.x + 1, p1.y + 1}, (vector_t) {p2.x - 1, p2.y - 1});
+        // Inset by one on every side.
+        shape_t *shape = shape_init_instance(shape_template_box(vec_subtract(size, (vector_t) {2, 2})), center);
         sprite_t *sprite = sprite_init(PLATFORM, REGULAR_BLOCK, 0, false);
         body_t *body = body_init_with_info(shape, PLATFORM_MASS, ORANGE, sprite, (free_func_t)sprite_free);
+        body_set_kind(body, BODY_STATIC);
         // Add the body to the PLAYER sublist.
         scene_add_body(scene, body, PLATFORM);
     }
@@ -165,146 +182,91 @@ void add_platform_corners(scene_t *scene, vector_t p1, vector_t p2, subrole_t su
 
 void add_background(scene_t *scene, vector_t size, subrole_t subrole)
 {
+    // Also used for the menu and cutscene scenes, which are not built by
+    // level_load().
+    arena_t *previous = mem_use_arena(scene_get_arena(scene));
     // Initialize a circle to back the player sprite.
     shape_t *shape = shape_init_rectangle((vector_t){0, 0}, size);
     sprite_t *sprite = sprite_init(BACKGROUND, subrole, 0, false);
 
     body_t *body = body_init_with_info(shape, PLATFORM_MASS, BLUE, sprite, (free_func_t)sprite_free);
+    body_set_kind(body, BODY_STATIC);
     scene_add_body(scene, body, BACKGROUND);
+    mem_use_arena(previous);
 }
 
 // Since firball is added mid game all its interactions need to be set when its added
 void initialize_fireball(scene_t *scene, body_t *fireball)
 {
-    
-    // Init fireball gameplay
-    list_t *enemy_list = scene_get_list(scene, ENEMY);
-    size_t size_enemy = list_size(enemy_list);
-    for (size_t q = 0; q < size_enemy; q++) // creates player/enemy actions
+    // What it hits is handled by the scene's pair handlers.
+    gameplay_create(scene, fireball, NULL, gameplay_gravity, (double*) &G, NULL);
+    gameplay_create(scene, fireball, NULL, gameplay_fireball_lifetime, scene, NULL);
+}
+
+// Registers the handlers between every pair of body types that react to each
+// other. Must be called once per scene, before it is ticked.
+void add_pair_handlers(scene_t *scene)
+{
+    // Everything that falls needs to land on platforms. Fireballs are powerups
+    // (though they are kept in the enemy list).
+    role_t movers[] = {PLAYER, ENEMY, POWERUP};
+    for (size_t r = 0; r < sizeof(movers) / sizeof(movers[0]); r++)
     {
-        body_t *enemy = list_get(enemy_list, q);
-        double *bounces = malloc(sizeof(double));
-        *bounces = 0;
-        gameplay_create(scene, enemy, fireball, gameplay_fireball, bounces, free);
+        scene_add_pair_handler(scene, movers[r], DISPATCH_ANY_SUBROLE, PLATFORM, REGULAR_BLOCK, gameplay_regular_block, NULL);
+        scene_add_pair_handler(scene, movers[r], DISPATCH_ANY_SUBROLE, PLATFORM, DEATH_BLOCK, gameplay_death_block, NULL);
     }
-    platform_roles_init_actions(scene, fireball);
+    scene_add_pair_handler(scene, PLAYER, DISPATCH_ANY_SUBROLE, PLATFORM, TUNNEL_BLOCK, gameplay_tunnel_block, NULL);
+    scene_add_pair_handler(scene, PLAYER, DISPATCH_ANY_SUBROLE, PLATFORM, ITEM_BLOCK, gameplay_item_block, NULL);
+    scene_add_pair_handler(scene, ENEMY, DISPATCH_ANY_SUBROLE, PLATFORM, INVISIBLE_BLOCK, gameplay_invisible_block, NULL);
+
+    scene_add_pair_handler(scene, PLAYER, DISPATCH_ANY_SUBROLE, ENEMY, GOOMBA, gameplay_goomba, NULL);
+    scene_add_pair_handler(scene, PLAYER, DISPATCH_ANY_SUBROLE, ENEMY, KOOPA, gameplay_koopa, NULL);
+    scene_add_pair_handler(scene, PLAYER, DISPATCH_ANY_SUBROLE, TOKEN, DISPATCH_ANY_SUBROLE, gameplay_token, NULL);
+    // Koopa shells knock out every other enemy, and fireballs hit every enemy.
+    scene_add_pair_handler(scene, ENEMY, DISPATCH_ANY_SUBROLE, ENEMY, KOOPA, gameplay_koopa_enemy, NULL);
+    scene_add_pair_handler(scene, ENEMY, DISPATCH_ANY_SUBROLE, POWERUP, FIREBALL, gameplay_fireball, NULL);
 }
 
 // Initializes all necessary actions for everything in scene for the entire game
 void add_interactions(scene_t *scene)
 {
-    list_t *player_list = scene_get_list(scene, PLAYER); // starts by init actions for players
-    for (size_t z = 0; z < list_size(player_list); z++)  // loops through all the players
+    add_pair_handlers(scene);
+    for (size_t role = 0; role < NUM_ROLES; role++)
     {
-        body_t *player = list_get(player_list, z);
-        gameplay_create(scene, player, NULL, gameplay_player, NULL, NULL);
-        double *time_invincibe = malloc(sizeof(double));
-        *time_invincibe = 0;
-        gameplay_create(scene, player, NULL, gameplay_star_powerup, time_invincibe, free);
-        // Init enemy gameplay
-        list_t *enemy_list = scene_get_list(scene, ENEMY);
-        size_t size_enemy = list_size(enemy_list);
-        for (size_t q = 0; q < size_enemy; q++) // creates player/enemy actions
-        {
-            body_t *enemy = list_get(enemy_list, q);
-            double *time_squashed = malloc(sizeof(double));
-            *time_squashed = 0;
-            if (sprite_subrole((sprite_t *)body_get_info(enemy)) == GOOMBA)
-            {
-                gameplay_create(scene, player, enemy, (force_creator_t)gameplay_goomba, time_squashed, free);
-            }
-            if (sprite_subrole((sprite_t *)body_get_info(enemy)) == KOOPA)
-            {
-                gameplay_create(scene, player, enemy, (force_creator_t)gameplay_koopa, time_squashed, free);
-            }
-
-            platform_roles_init_actions(scene, enemy); //Inits platform/enemy actions
-            // Sets gameplay mechanics for enemy only once
-            if (z == 0 && sprite_subrole((sprite_t*) body_get_info(enemy)) != KOOPA)
-            {
-                create_bot_mechanics(scene, enemy, ENEMY_SPEED);
-            } else {body_set_velocity(enemy, ENEMY_SPEED);}
-            if (z == 0)
-            {
-                enemy_enemy_init_actions(scene, enemy_list, enemy, size_enemy, q);
-            }
-        }
-        // Init tokens gameplay
-        list_t *token_list = scene_get_list(scene, TOKEN);
-        size_t size_token = list_size(token_list);
-        for (size_t q = 0; q < size_token; q++) // creates player/token actions
-        {
-            gameplay_create(scene, player, list_get(token_list, q), (force_creator_t)gameplay_token, NULL, NULL);
-        }
-        // Init powerup gameplay ....
-        list_t *powerup_list = scene_get_list(scene, POWERUP);
-        size_t size_powerup = list_size(powerup_list);
-        for (size_t q = 0; q < size_powerup; q++) // creates player/powerup actions
-        {
-            body_t *powerup = list_get(powerup_list, q);
-            // gameplay_create(scene, player, powerup, (force_creator_t) , NULL, NULL);
-            platform_roles_init_actions(scene, powerup); //Inits platform/powerup actions
-            if (z == 0)
-            {
-                create_bot_mechanics(scene, powerup, POWERUP_SPEED);
-            }
-        }
-
-        // create_drag(scene, DRAG, player);
-        platform_roles_init_actions(scene, player);
+        list_t *bodies = scene_get_list(scene, role);
+        for (size_t i = 0; i < list_size(bodies); i++) {initialize_body(scene, list_get(bodies, i));}
     }
 }
 
-// Initializes actions between the platform and a role
-void platform_roles_init_actions(scene_t *scene, body_t *body)
+// Initializes the actions of a body of its own, such as gravity. What it does
+// to other bodies is up to the pair handlers, so nothing else in the scene has
+// to be wired to it.
+void initialize_body(scene_t *scene, body_t *body)
 {
-    if (scene_size(scene) > PLATFORM)
+    sprite_t *sprite = (sprite_t *)body_get_info(body);
+    role_t role = sprite_role(sprite);
+
+    if (role == PLAYER)
     {
-        list_t *platform_list = scene_get_list(scene, PLATFORM);
-        size_t size_platform = list_size(platform_list);
-        // Sets gravity to uniform -1e4.
-        double *aux = malloc(sizeof(double));
-        *aux = G;
-        gameplay_create(scene, body, NULL, gameplay_gravity, aux, free);
-        for (size_t q = 0; q < size_platform; q++) // creates player/platform
-        {
-            body_t *platform = list_get(platform_list, q);
-            if (sprite_subrole((sprite_t *)body_get_info(platform)) == REGULAR_BLOCK)
-            {
-                gameplay_create(scene, body, platform, gameplay_regular_block, NULL, NULL);
-            }
-            if (sprite_subrole((sprite_t *)body_get_info(platform)) == DEATH_BLOCK)
-            {
-                gameplay_create(scene, body, platform, gameplay_death_block, NULL, NULL);
-            }
-            if (sprite_subrole((sprite_t *)body_get_info(platform)) == TUNNEL_BLOCK && sprite_role((sprite_t *)body_get_info(body)) == PLAYER)
-            {
-                gameplay_create(scene, body, platform, gameplay_tunnel_block, NULL, NULL);
-            }
-            if (sprite_subrole((sprite_t *)body_get_info(platform)) == ITEM_BLOCK && sprite_role((sprite_t *)body_get_info(body)) == PLAYER)
-            {
-                gameplay_create(scene, body, platform, gameplay_item_block, scene, NULL);
-            }
-            if (sprite_subrole((sprite_t *)body_get_info(platform)) == INVISIBLE_BLOCK && sprite_role((sprite_t *)body_get_info(body)) == ENEMY)
-            {
-                gameplay_create(scene, body, platform, gameplay_invisible_block, scene, NULL);
-            }
-        }
+        gameplay_create(scene, body, NULL, gameplay_player, NULL, NULL);
+        gameplay_create(scene, body, NULL, gameplay_star_powerup, scene, NULL);
+        // Sets gravity to uniform G. Every body shares the same constant.
+        gameplay_create(scene, body, NULL, gameplay_gravity, (double*) &G, NULL);
     }
-}
-
-void enemy_enemy_init_actions(scene_t *scene, list_t *list_bodies, body_t *body, size_t size, size_t curr_index)
-{
-    if (sprite_subrole((sprite_t *)body_get_info(body)) == KOOPA)
+    else if (role == ENEMY)
     {
-        for (size_t q = 0; q < size; q++) // creates enemy, koopa
+        gameplay_create(scene, body, NULL, gameplay_gravity, (double*) &G, NULL);
+        if (sprite_subrole(sprite) != KOOPA) {create_bot_mechanics(scene, body, ENEMY_SPEED);}
+        if (sprite_subrole(sprite) == GOOMBA) {gameplay_create(scene, body, NULL, gameplay_goomba_squashed, scene, NULL);}
+        else
         {
-            double *time = malloc(sizeof(double));
-            *time = 0;
-            if (q != curr_index)
-            {
-                gameplay_create(scene, list_get(list_bodies, q), body, gameplay_koopa_enemy, time, free);
-            }
+            body_set_velocity(body, ENEMY_SPEED);
+            gameplay_create(scene, body, NULL, gameplay_koopa_facing, NULL, NULL);
         }
     }
-}
\ No newline at end of file
+    else if (role == POWERUP)
+    {
+        gameplay_create(scene, body, NULL, gameplay_gravity, (double*) &G, NULL);
+        create_bot_mechanics(scene, body, POWERUP_SPEED);
+    }
+}
@@ -1,4 +1,8 @@
 #include "interaction.h"
+#include "memory.h"
+
+// Interactions with at most this many bodies keep their links inline.
+#define INTERACTION_INLINE_LINKS 2
 
 
 // A 'interaction' which contains information relevant for a force_creator_t.
@@ -12,19 +16,51 @@ typedef struct interaction
     // The force involved in the interaction interaction.
     force_creator_t forcer;
 
-    bool colliding;
+    // Whether the interaction only needs to run while its two bodies are close
+    // to each other (see scene_add_collision_force_creator()), and the last
+    // scene tick in which the broad phase found them close.
+    bool on_contact;
+    size_t tick;
+    // What the scene found between the two bodies this tick.
+    contact_event_t event;
+    collision_info_t collision;
+
+    interaction_state_t state;
+
+    // Where the interaction is stored in the scene's list of interactions, and
+    // in the interaction list of each of its bodies, so it can be unlinked
+    // without searching.
+    size_t index;
+    // Where the interaction is stored in the scene's list of the interactions
+    // to run, or INTERACTION_INACTIVE.
+    size_t active;
+    size_t *links;
+    size_t inline_links[INTERACTION_INLINE_LINKS];
 
 } interaction_t;
 
 
+// A fireball alone brings an interaction with every platform and enemy, so
+// freed interactions are kept for the next one.
+pool_t INTERACTION_POOL = POOL_INIT("interaction", interaction_t);
+
+
 // Initializes a interaction containing the relevant bodies and force constant.
 interaction_t *interaction_init(list_t *bodies, void *aux, free_func_t aux_freer, force_creator_t forcer)
 {
-    interaction_t *interaction = malloc(sizeof(interaction_t));
+    interaction_t *interaction = pool_alloc(&INTERACTION_POOL);
     assert(interaction != NULL);
 
     interaction -> bodies = bodies;
-    interaction -> colliding = false;
+    interaction -> on_contact = false;
+    interaction -> tick = 0;
+    interaction -> event = CONTACT_NONE;
+    interaction -> collision = (collision_info_t) {0};
+    interaction -> state = (interaction_state_t) {0};
+    interaction -> index = 0;
+    interaction -> active = INTERACTION_INACTIVE;
+    if (list_size(bodies) <= INTERACTION_INLINE_LINKS) {interaction -> links = interaction -> inline_links;}
+    else {interaction -> links = mem_calloc(list_size(bodies), sizeof(size_t));}
     interaction -> aux = aux;
     interaction -> aux_freer = aux_freer;
 
@@ -42,10 +78,10 @@ void interaction_free(interaction_t *interaction)
     {
         (interaction -> aux_freer)(interaction -> aux);
     }
-    void** arr = list_arr(interaction -> bodies);
-    free(arr);
-    free(interaction -> bodies);
-    free(interaction);
+    // The bodies belong to the scene, whatever the freer of the list says.
+    list_free_shallow(interaction -> bodies);
+    if (interaction -> links != interaction -> inline_links) {mem_free(interaction -> links);}
+    pool_free(&INTERACTION_POOL, interaction);
 }
 
 
@@ -78,30 +114,88 @@ list_t* interaction_get_bodies(interaction_t* interaction)
     return interaction -> bodies;
 }
 
-bool interaction_is_colliding(interaction_t* interaction)
+void interaction_set_aux(interaction_t* interaction, void* aux)
 {
-    return interaction -> colliding;
+    void* old_aux = interaction -> aux;
+    interaction -> aux = aux;
+    if (interaction -> aux_freer != NULL) {(interaction -> aux_freer)(old_aux);}
 }
 
-void interaction_set_colliding(interaction_t* interaction, bool value)
+size_t interaction_get_index(interaction_t* interaction)
 {
-    interaction -> colliding = value;
+    return interaction -> index;
 }
 
-void interaction_set_aux(interaction_t* interaction, void* aux)
+void interaction_set_index(interaction_t* interaction, size_t index)
 {
-    void* old_aux = interaction -> aux;
-    interaction -> aux = aux;
-    free(old_aux);
+    interaction -> index = index;
 }
 
-// Prevents function to run twice during a collision
-bool interaction_colliding(interaction_t* interaction)
-{   
-    if(interaction -> colliding)
-    {
-        interaction -> colliding = false;
-        return true;
-    }
-    return false;
+size_t interaction_get_active(interaction_t* interaction)
+{
+    return interaction -> active;
+}
+
+void interaction_set_active(interaction_t* interaction, size_t active)
+{
+    interaction -> active = active;
+}
+
+size_t interaction_get_link(interaction_t* interaction, size_t index)
+{
+    assert(index < list_size(interaction -> bodies));
+    return interaction -> links[index];
+}
+
+void interaction_set_link(interaction_t* interaction, size_t index, size_t link)
+{
+    assert(index < list_size(interaction -> bodies));
+    interaction -> links[index] = link;
+}
+
+interaction_state_t* interaction_get_state(interaction_t* interaction)
+{
+    return &interaction -> state;
+}
+
+
+bool interaction_is_on_contact(interaction_t* interaction)
+{
+    return interaction -> on_contact;
+}
+
+void interaction_set_on_contact(interaction_t* interaction, bool value)
+{
+    interaction -> on_contact = value;
+}
+
+size_t interaction_get_tick(interaction_t* interaction)
+{
+    return interaction -> tick;
+}
+
+void interaction_set_tick(interaction_t* interaction, size_t tick)
+{
+    interaction -> tick = tick;
+}
+
+contact_event_t interaction_get_event(interaction_t* interaction)
+{
+    return interaction -> event;
+}
+
+bool interaction_is_touching(interaction_t* interaction)
+{
+    return interaction -> event == CONTACT_BEGIN || interaction -> event == CONTACT_STAY;
+}
+
+collision_info_t interaction_get_collision(interaction_t* interaction)
+{
+    return interaction -> collision;
+}
+
+void interaction_set_contact(interaction_t* interaction, contact_event_t event, collision_info_t collision)
+{
+    interaction -> event = event;
+    interaction -> collision = collision;
 }
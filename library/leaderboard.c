@@ -42,17 +42,18 @@ list_t* leaderboard_init()
 
     // Reads leaderboard line by line until reaching end of function.
     
-    size_t* tokens = malloc(sizeof(size_t));
-    size_t* kills = malloc(sizeof(size_t));
+    size_t tokens;
+    size_t kills;
     
-    // CHECK ARGUMENTS; not sure if we shouls be passing by reference.
+    // The names are only needed until the leaderboard is shown or saved, so
+    // they are scratch memory.
     while(true)
     {
-        char* name = malloc(sizeof(char*) * 100);
-        if(fscanf(file, "%s %zu %zu", name, tokens, kills) == EOF) {break;}
+        char* name = frame_alloc(sizeof(char) * 100);
+        if(fscanf(file, "%99s %zu %zu", name, &tokens, &kills) == EOF) {break;}
         // Adds all info of each row to leaderboard list
         entry_t* entry = malloc(sizeof(entry_t));
-        *entry = (entry_t) {name, *tokens, *kills};  
+        *entry = (entry_t) {name, tokens, kills};  
         list_add(leaderboard, entry);
     }
     fclose(file);
@@ -100,9 +101,8 @@ bool leaderboard_show()
         // Prints leaderboard in command line.
         entry_t entry = *(entry_t*) list_get(leaderboard, i);
         // First field is the place, leaderboard is stored in order.
-        char* str = malloc(sizeof(char) * 30);
-        str[0] = '\0';
-        sprintf(str, "%lu    %s    %zu    %zu", (i + 1), entry.name, entry.tokens, entry.kills);
+        char* str = frame_alloc(sizeof(char) * 160);
+        snprintf(str, 160, "%zu    %s    %zu    %zu", (i + 1), entry.name, entry.tokens, entry.kills);
         sdl_write_title(str, ORANGE, (vector_t) {LINE2.x, LINE2.y + i * LINE_INC});
     }
     sdl_write_title("[enter or esc to return to main menu]", ORANGE, (vector_t) {LINE1.x, 50});
@@ -148,8 +148,7 @@ list_t* leaderboard_sort(list_t* leaderboard)
     for (size_t i = 0; i < size; i ++) {list_add(new_entries, (entry_t*) arr[i]);}
 
     // Make sure to not free the entries being pointed to by the list!
-    free(list_arr(old_entries));
-    free(old_entries);
+    list_free_shallow(old_entries);
 
     return new_entries;
 }
@@ -0,0 +1,156 @@
+#include "level_cache.h"
+#include "memory.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Marks a file as a level image.
+const char LEVEL_CACHE_MAGIC[4] = {'S', 'M', 'L', 'V'};
+// Bumped whenever the meaning of a record changes.
+const uint32_t LEVEL_CACHE_VERSION = 1;
+// Longest path of an image.
+#define LEVEL_CACHE_PATH_SIZE 256
+
+
+// Sits at the start of an image, in front of its records.
+typedef struct level_cache_header
+{
+    char magic[4];
+    uint32_t version;
+    // Images written by a build with a different record layout are not used.
+    uint32_t record_size;
+    uint32_t count;
+    // The level file the image was made from, as it was then.
+    int64_t source_mtime;
+    int64_t source_size;
+} level_cache_header_t;
+
+// The records right after the header have to stay aligned for their doubles.
+_Static_assert(sizeof(level_cache_header_t) % sizeof(double) == 0, "Misaligned level image records.");
+
+
+// Definition of the level_cache struct.
+typedef struct level_cache
+{
+    void *image;
+    size_t image_size;
+    const level_record_t *records;
+    size_t count;
+} level_cache_t;
+
+
+// Gets the path of the image of a level file: its extension is replaced by
+// ".bin".
+void level_cache_path(const char *source, char *path, size_t size)
+{
+    const char *extension = strrchr(source, '.');
+    const char *slash = strrchr(source, '/');
+    int length = (extension != NULL && (slash == NULL || extension > slash)) ? (int) (extension - source) : (int) strlen(source);
+    snprintf(path, size, "%.*s.bin", length, source);
+}
+
+
+// Maps the image of a level file into memory, if it is up to date.
+level_cache_t *level_cache_open(const char *source)
+{
+    struct stat source_stat;
+    if (stat(source, &source_stat) != 0) {return NULL;}
+    char path[LEVEL_CACHE_PATH_SIZE];
+    level_cache_path(source, path, sizeof(path));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {return NULL;}
+    struct stat image_stat;
+    if (fstat(fd, &image_stat) != 0 || (size_t) image_stat.st_size < sizeof(level_cache_header_t))
+    {
+        close(fd);
+        return NULL;
+    }
+    size_t image_size = (size_t) image_stat.st_size;
+    void *image = mmap(NULL, image_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the file is closed.
+    close(fd);
+    if (image == MAP_FAILED) {return NULL;}
+
+    const level_cache_header_t *header = image;
+    if (memcmp(header -> magic, LEVEL_CACHE_MAGIC, sizeof(LEVEL_CACHE_MAGIC)) != 0
+        || header -> version != LEVEL_CACHE_VERSION
+        || header -> record_size != sizeof(level_record_t)
+        || header -> source_mtime != (int64_t) source_stat.st_mtime
+        || header -> source_size != (int64_t) source_stat.st_size
+        || image_size != sizeof(level_cache_header_t) + header -> count * sizeof(level_record_t))
+    {
+        munmap(image, image_size);
+        return NULL;
+    }
+
+    level_cache_t *cache = mem_alloc(sizeof(level_cache_t));
+    assert(cache != NULL);
+    cache -> image = image;
+    cache -> image_size = image_size;
+    cache -> records = (const level_record_t*) (header + 1);
+    cache -> count = header -> count;
+    return cache;
+}
+
+
+// Unmaps an image.
+void level_cache_close(level_cache_t *cache)
+{
+    munmap(cache -> image, cache -> image_size);
+    mem_free(cache);
+}
+
+
+// Gets the number of records in an image.
+size_t level_cache_size(level_cache_t *cache)
+{
+    return cache -> count;
+}
+
+
+// Gets the records of an image.
+const level_record_t *level_cache_records(level_cache_t *cache)
+{
+    return cache -> records;
+}
+
+
+// Saves the records read from a level file as its image. The image is written
+// to a temporary file first and then renamed over the old one, so a game
+// loading the level at the same time never sees half an image.
+bool level_cache_write(const char *source, const level_record_t *records, size_t count)
+{
+    struct stat source_stat;
+    if (stat(source, &source_stat) != 0) {return false;}
+    char path[LEVEL_CACHE_PATH_SIZE];
+    level_cache_path(source, path, sizeof(path));
+    char temporary[LEVEL_CACHE_PATH_SIZE + 4];
+    snprintf(temporary, sizeof(temporary), "%s.tmp", path);
+
+    level_cache_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LEVEL_CACHE_MAGIC, sizeof(LEVEL_CACHE_MAGIC));
+    header.version = LEVEL_CACHE_VERSION;
+    header.record_size = sizeof(level_record_t);
+    header.count = (uint32_t) count;
+    header.source_mtime = (int64_t) source_stat.st_mtime;
+    header.source_size = (int64_t) source_stat.st_size;
+
+    FILE *file = fopen(temporary, "wb");
+    if (file == NULL) {return false;}
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(records, sizeof(level_record_t), count, file) == count;
+    written = (fclose(file) == 0) && written;
+    if (!written || rename(temporary, path) != 0)
+    {
+        remove(temporary);
+        return false;
+    }
+    return true;
+}
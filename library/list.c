@@ -1,4 +1,5 @@
 #include "list.h"
+#include "memory.h"
 
 #include <stdio.h>
 #include <stddef.h>
@@ -9,6 +10,11 @@
 #include "vector.h"
 
 const size_t LIST_RESIZE_FACTOR = 2;
+// Lists come and go as a level streams in and out. Backing arrays of up to
+// this many elements have a power of two capacity, and are pooled by capacity
+// (along with every list struct) so they are reused instead of carved again.
+const size_t LIST_POOLED_CAPACITY = 256;
+#define LIST_NUM_ARRAY_POOLS 8
 
 
 // Definition of the list struct.
@@ -21,21 +27,75 @@ typedef struct list
 } list_t;
 
 
+pool_t LIST_POOL = POOL_INIT("list", list_t);
+pool_t LIST_ARRAY_POOLS[LIST_NUM_ARRAY_POOLS] = {
+    POOL_INIT("list 2", void*[2]),
+    POOL_INIT("list 4", void*[4]),
+    POOL_INIT("list 8", void*[8]),
+    POOL_INIT("list 16", void*[16]),
+    POOL_INIT("list 32", void*[32]),
+    POOL_INIT("list 64", void*[64]),
+    POOL_INIT("list 128", void*[128]),
+    POOL_INIT("list 256", void*[256])
+};
+
+
+// Rounds a capacity up to the next power of two, if it is small enough for its
+// array to be pooled.
+size_t list_round_capacity(size_t capacity)
+{
+    if (capacity > LIST_POOLED_CAPACITY) {return capacity;}
+    size_t rounded = 2;
+    while (rounded < capacity) {rounded *= 2;}
+    return rounded;
+}
+
+
+// Gets the pool the arrays of the given capacity come from, or NULL.
+pool_t *list_array_pool(size_t capacity)
+{
+    for (size_t i = 0; i < LIST_NUM_ARRAY_POOLS; i ++)
+    {
+        if (LIST_ARRAY_POOLS[i].size == capacity * sizeof(void*)) {return &LIST_ARRAY_POOLS[i];}
+    }
+    return NULL;
+}
+
+
+// Allocates a backing array of the given capacity from an arena (or the
+// heap).
+void **list_alloc_array(size_t capacity, arena_t *arena)
+{
+    pool_t *pool = list_array_pool(capacity);
+    void **arr = (pool != NULL) ? pool_alloc_from(pool, arena) : mem_alloc_from(arena, capacity * sizeof(void*));
+    assert(arr != NULL);
+    return arr;
+}
+
+
+// Releases a backing array of the given capacity.
+void list_free_array(void **arr, size_t capacity)
+{
+    pool_t *pool = list_array_pool(capacity);
+    if (pool != NULL) {pool_free(pool, arr);}
+    else {mem_free(arr);}
+}
+
+
 // Allocates memory for a new list with space for the given number of elements.
 list_t *list_init(size_t initial_size, free_func_t freer)
 {
-    list_t *list = malloc(sizeof(list_t));
+    list_t *list = pool_alloc(&LIST_POOL);
     assert(list != NULL);
 
     list -> size = 0;
-    list -> capacity = initial_size;
+    list -> capacity = list_round_capacity(initial_size);
     // Note that free_func_t is defined in list.h.
     list -> freer = freer;
 
     // The array is just storing pointers to vector_t objects, so allocate
     // memory for storing an integer.
-    list -> arr = malloc(initial_size * sizeof(void*));
-    assert(list -> arr != NULL);
+    list -> arr = list_alloc_array(list -> capacity, mem_owner(list));
 
     return list;
 }
@@ -44,16 +104,23 @@ list_t *list_init(size_t initial_size, free_func_t freer)
 // Releases the memory allocated for a list.
 void list_free(list_t *list)
 {
-    // Free every vector in the backing array.
-    for (size_t i = 0; i < list->size; i++)
+    // Free every vector in the backing array. A list without a freer does not
+    // own its elements, so they are left alone.
+    for (size_t i = 0; i < list->size && list -> freer != NULL; i++)
     {
-        assert(list -> freer != NULL);
         assert(list -> arr[i] != NULL);
         list -> freer(list -> arr[i]);
     }
 
-    free(list -> arr);
-    free(list);
+    list_free_shallow(list);
+}
+
+
+// Releases the memory allocated for a list, but not its elements.
+void list_free_shallow(list_t *list)
+{
+    list_free_array(list -> arr, list -> capacity);
+    pool_free(&LIST_POOL, list);
 }
 
 
@@ -76,7 +143,7 @@ void list_replace(list_t *list, size_t index, void *elem)
     void *old = list -> arr[index];
     list -> arr[index] = elem;
 
-    free(old);
+    if (list -> freer != NULL) {list -> freer(old);}
 }
 
 
@@ -89,8 +156,19 @@ void list_add(list_t *list, void *elem)
     // Resize the list if capacity is reached.
     if (list -> size == list -> capacity)
     {
-        list -> arr = realloc(list -> arr, 2 * list -> capacity * sizeof(void*));
-        list -> capacity *= 2;
+        // The list grows within the arena it came from, whichever one is
+        // current.
+        size_t capacity = LIST_RESIZE_FACTOR * list -> capacity;
+        if (list -> capacity <= LIST_POOLED_CAPACITY)
+        {
+            // A pooled array goes back to its pool instead of being resized.
+            void **arr = list_alloc_array(capacity, mem_owner(list));
+            memcpy(arr, list -> arr, list -> size * sizeof(void*));
+            list_free_array(list -> arr, list -> capacity);
+            list -> arr = arr;
+        }
+        else {list -> arr = mem_realloc(list -> arr, capacity * sizeof(void*));}
+        list -> capacity = capacity;
     }
 
     list -> arr[list -> size] = elem;
@@ -120,6 +198,64 @@ void *list_remove(list_t *list, size_t index)
 
 
 
+// Removes the element at the specified index by moving the last element into
+// its place, and returns it.
+void *list_swap_remove(list_t *list, size_t index)
+{
+    assert(list -> size != 0 && index < list -> size);
+    void *elem = list -> arr[index];
+    list -> size --;
+    list -> arr[index] = list -> arr[list -> size];
+    list -> arr[list -> size] = NULL;
+    return elem;
+}
+
+
+// Overwrites the element at the specified index without freeing the old one.
+void list_set(list_t *list, size_t index, void *elem)
+{
+    assert(index < list -> size);
+    list -> arr[index] = elem;
+}
+
+
+// Removes every NULL element from a list, keeping the order of the rest.
+void list_compact(list_t *list)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < list -> size; i ++)
+    {
+        if (list -> arr[i] == NULL) {continue;}
+        list -> arr[kept] = list -> arr[i];
+        kept ++;
+    }
+    list -> size = kept;
+}
+
+
+// Removes every element for which the predicate returns true, keeping the
+// order of the rest.
+size_t list_remove_if(list_t *list, predicate_t predicate, list_t *removed)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < list -> size; i ++)
+    {
+        void *elem = list -> arr[i];
+        if (!predicate(elem))
+        {
+            list -> arr[kept] = elem;
+            kept ++;
+        }
+        else if (removed != NULL) {list_add(removed, elem);}
+        else if (list -> freer != NULL) {list -> freer(elem);}
+    }
+
+    size_t count = list -> size - kept;
+    list -> size = kept;
+    return count;
+}
+
+
 // Adds the contents of one list to another list, and DOES NOT FREE THE
 // POINTERS IN THE SECOND LIST.
 void list_extend(list_t* list, list_t* another_list)
@@ -130,8 +266,7 @@ void list_extend(list_t* list, list_t* another_list)
         list_add(list, elem);
     }
     
-    free(list_arr(another_list));
-    free(another_list);
+    list_free_shallow(another_list);
 }
 
 // Checks if two lists of vectors are equal
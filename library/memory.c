@@ -0,0 +1,411 @@
+#include "memory.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+
+// Every allocation is aligned to this many bytes, like malloc().
+const size_t MEM_ALIGNMENT = 16;
+// The scratch arena starts out with blocks of this many bytes.
+const size_t FRAME_ARENA_BLOCK = 16 * 1024;
+// The number of sizes large arena allocations are rounded up to, each twice
+// the one before, starting at MEM_RECYCLE_SIZE.
+#define MEM_SIZE_CLASSES 24
+
+
+// One block of an arena. Blocks are chained so they can all be freed together.
+typedef struct arena_block
+{
+    struct arena_block *next;
+    size_t capacity;
+    size_t used;
+    unsigned char *data;
+} arena_block_t;
+
+
+// Definition of the arena struct.
+typedef struct arena
+{
+    // The block being carved from; older blocks follow it.
+    arena_block_t *head;
+    size_t block_size;
+    size_t used;
+    // Objects given back to each pool (indexed by pool id) that were carved
+    // from this arena.
+    void *free_lists[MEM_MAX_POOLS + 1];
+    // Large allocations that were freed, by size class (see mem_size_class()).
+    // Each starts with its header, followed by the next one.
+    void *recycled[MEM_SIZE_CLASSES];
+} arena_t;
+
+
+// Sits in front of everything returned by mem_alloc(). Its size is a multiple
+// of MEM_ALIGNMENT, so the memory after it stays aligned.
+typedef struct mem_header
+{
+    arena_t *owner;
+    size_t size;
+} mem_header_t;
+
+
+// The arena mem_alloc() carves from, or NULL for the heap.
+static arena_t *current_arena = NULL;
+
+// Every pool used so far, indexed by id. Id 0 means not used yet.
+static pool_t *pools[MEM_MAX_POOLS + 1];
+static size_t num_pools = 0;
+
+// Scratch memory for the current frame, created when it is first needed.
+static arena_t *frame_arena = NULL;
+
+
+// Rounds a size up to a multiple of MEM_ALIGNMENT.
+size_t mem_align(size_t size)
+{
+    return (size + MEM_ALIGNMENT - 1) & ~(MEM_ALIGNMENT - 1);
+}
+
+
+// Allocates memory for an empty arena.
+arena_t *arena_init(size_t block_size)
+{
+    arena_t *arena = malloc(sizeof(arena_t));
+    assert(arena != NULL);
+    arena -> head = NULL;
+    arena -> block_size = mem_align(block_size);
+    arena -> used = 0;
+    memset(arena -> free_lists, 0, sizeof(arena -> free_lists));
+    memset(arena -> recycled, 0, sizeof(arena -> recycled));
+    return arena;
+}
+
+
+// Releases every block of the arena, and the arena itself.
+void arena_free(arena_t *arena)
+{
+    if (current_arena == arena) {current_arena = NULL;}
+    arena_block_t *block = arena -> head;
+    while (block != NULL)
+    {
+        arena_block_t *next = block -> next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+
+// Gets the number of bytes handed out by the arena so far.
+size_t arena_used(arena_t *arena)
+{
+    return arena -> used;
+}
+
+
+// Takes back everything carved from the arena. If it had grown past one
+// block, the blocks are replaced by a single one big enough for all of it, so
+// an arena that is reset over and over (like the scratch arena) settles on one
+// block and stops allocating.
+void arena_reset(arena_t *arena)
+{
+    memset(arena -> free_lists, 0, sizeof(arena -> free_lists));
+    memset(arena -> recycled, 0, sizeof(arena -> recycled));
+    arena -> used = 0;
+    arena_block_t *block = arena -> head;
+    if (block == NULL) {return;}
+    if (block -> next == NULL)
+    {
+        block -> used = 0;
+        return;
+    }
+
+    size_t total = 0;
+    while (block != NULL)
+    {
+        arena_block_t *next = block -> next;
+        total += block -> capacity;
+        free(block);
+        block = next;
+    }
+    arena -> head = NULL;
+    if (total > arena -> block_size) {arena -> block_size = total;}
+}
+
+
+// Carves size bytes from the arena, starting a new block if the current one is
+// full. Requests bigger than a block get a block of their own.
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    size = mem_align(size);
+    arena_block_t *block = arena -> head;
+    if (block == NULL || block -> used + size > block -> capacity)
+    {
+        size_t capacity = (size > arena -> block_size) ? size : arena -> block_size;
+        block = malloc(mem_align(sizeof(arena_block_t)) + capacity);
+        assert(block != NULL);
+        block -> data = (unsigned char*) block + mem_align(sizeof(arena_block_t));
+        block -> capacity = capacity;
+        block -> used = 0;
+        block -> next = arena -> head;
+        arena -> head = block;
+    }
+    void *ptr = block -> data + block -> used;
+    block -> used += size;
+    arena -> used += size;
+    return ptr;
+}
+
+
+// Sets the arena mem_alloc() carves memory from, and returns the previous one.
+arena_t *mem_use_arena(arena_t *arena)
+{
+    arena_t *previous = current_arena;
+    current_arena = arena;
+    return previous;
+}
+
+
+// Gets the arena mem_alloc() currently carves memory from.
+arena_t *mem_current_arena(void)
+{
+    return current_arena;
+}
+
+
+// Gets the size class of a large arena allocation, or MEM_SIZE_CLASSES if it
+// is too small (or too large) to be reused.
+size_t mem_size_class(size_t size)
+{
+    if (size < MEM_RECYCLE_SIZE) {return MEM_SIZE_CLASSES;}
+    size_t class = 0;
+    while (class < MEM_SIZE_CLASSES && ((size_t) MEM_RECYCLE_SIZE << class) < size) {class ++;}
+    return class;
+}
+
+
+// Gets how many bytes an arena allocation of the given size takes up.
+size_t mem_capacity(size_t size)
+{
+    size_t class = mem_size_class(size);
+    return (class < MEM_SIZE_CLASSES) ? ((size_t) MEM_RECYCLE_SIZE << class) : size;
+}
+
+
+// Gets the header in front of an allocation.
+mem_header_t *mem_header(void *ptr)
+{
+    return (mem_header_t*) ((unsigned char*) ptr - mem_align(sizeof(mem_header_t)));
+}
+
+
+// Allocates size bytes, behind a header recording where they came from.
+void *mem_alloc_from(arena_t *arena, size_t size)
+{
+    mem_header_t *header;
+    size_t class = mem_size_class(size);
+    if (arena == NULL) {header = malloc(mem_align(sizeof(mem_header_t)) + size);}
+    else if (class < MEM_SIZE_CLASSES && arena -> recycled[class] != NULL)
+    {
+        header = arena -> recycled[class];
+        arena -> recycled[class] = *(void**) ((unsigned char*) header + mem_align(sizeof(mem_header_t)));
+    }
+    else {header = arena_alloc(arena, mem_align(sizeof(mem_header_t)) + mem_capacity(size));}
+    assert(header != NULL);
+    header -> owner = arena;
+    header -> size = size;
+    return (unsigned char*) header + mem_align(sizeof(mem_header_t));
+}
+
+
+// Allocates size bytes from the current arena, or the heap.
+void *mem_alloc(size_t size)
+{
+    return mem_alloc_from(current_arena, size);
+}
+
+
+// Allocates zeroed memory for count elements of the given size.
+void *mem_calloc(size_t count, size_t size)
+{
+    void *ptr = mem_alloc(count * size);
+    memset(ptr, 0, count * size);
+    return ptr;
+}
+
+
+// Resizes an allocation. Heap memory is reallocated in place if possible;
+// arena memory is copied to a new allocation from the same arena, and the old
+// one is left for the arena to reclaim.
+void *mem_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL) {return mem_alloc(size);}
+    mem_header_t *header = mem_header(ptr);
+    if (header -> owner == NULL)
+    {
+        header = realloc(header, mem_align(sizeof(mem_header_t)) + size);
+        assert(header != NULL);
+        header -> size = size;
+        return (unsigned char*) header + mem_align(sizeof(mem_header_t));
+    }
+
+    // Large allocations have room to grow up to their size class.
+    if (mem_size_class(header -> size) < MEM_SIZE_CLASSES && size >= MEM_RECYCLE_SIZE
+        && size <= mem_capacity(header -> size))
+    {
+        header -> size = size;
+        return ptr;
+    }
+    void *resized = mem_alloc_from(header -> owner, size);
+    memcpy(resized, ptr, (header -> size < size) ? header -> size : size);
+    mem_free(ptr);
+    return resized;
+}
+
+
+// Releases an allocation. Large arena allocations are handed back to their
+// arena to be reused; the rest of arena memory is left for its arena to
+// reclaim.
+void mem_free(void *ptr)
+{
+    if (ptr == NULL) {return;}
+    mem_header_t *header = mem_header(ptr);
+    arena_t *arena = header -> owner;
+    if (arena == NULL)
+    {
+        free(header);
+        return;
+    }
+    size_t class = mem_size_class(header -> size);
+    if (class == MEM_SIZE_CLASSES) {return;}
+    *(void**) ptr = arena -> recycled[class];
+    arena -> recycled[class] = header;
+}
+
+
+// Gets the arena an allocation was carved from.
+arena_t *mem_owner(void *ptr)
+{
+    assert(ptr != NULL);
+    return mem_header(ptr) -> owner;
+}
+
+
+// Gets the free list an object of the pool goes on, depending on the arena it
+// belongs to.
+void **pool_free_list(pool_t *pool, arena_t *arena)
+{
+    if (pool -> id == 0)
+    {
+        assert(num_pools < MEM_MAX_POOLS && "Too many pools.");
+        // A free object stores the next one in its first bytes.
+        assert(pool -> size >= sizeof(void*));
+        num_pools ++;
+        pool -> id = num_pools;
+        pools[num_pools] = pool;
+    }
+    return (arena != NULL) ? &arena -> free_lists[pool -> id] : &pool -> free_list;
+}
+
+
+// Allocates an object from the pool, reusing a freed one if possible.
+void *pool_alloc(pool_t *pool)
+{
+    return pool_alloc_from(pool, current_arena);
+}
+
+
+// Allocates an object from the pool out of the given arena, reusing one freed
+// there if possible.
+void *pool_alloc_from(pool_t *pool, arena_t *arena)
+{
+    void **free_list = pool_free_list(pool, arena);
+    void *ptr = *free_list;
+    if (ptr != NULL)
+    {
+        *free_list = *(void**) ptr;
+#ifdef POOL_STATS
+        pool -> stats.reused ++;
+#endif
+    }
+    else {ptr = mem_alloc_from(arena, pool -> size);}
+
+#ifdef POOL_STATS
+    pool -> stats.allocated ++;
+    pool -> stats.live ++;
+    if (pool -> stats.live > pool -> stats.peak) {pool -> stats.peak = pool -> stats.live;}
+#endif
+    return ptr;
+}
+
+
+// Puts an object on the free list of the arena it was carved from, or the
+// pool's own list if it came from the heap.
+void pool_free(pool_t *pool, void *ptr)
+{
+    if (ptr == NULL) {return;}
+    assert(mem_header(ptr) -> size == pool -> size && "Object is not from this pool.");
+    void **free_list = pool_free_list(pool, mem_owner(ptr));
+    *(void**) ptr = *free_list;
+    *free_list = ptr;
+
+#ifdef POOL_STATS
+    pool -> stats.freed ++;
+    pool -> stats.live --;
+#endif
+}
+
+
+// Releases the freed heap objects every pool is keeping.
+void pool_clear(void)
+{
+    for (size_t i = 1; i <= num_pools; i ++)
+    {
+        void *ptr = pools[i] -> free_list;
+        while (ptr != NULL)
+        {
+            void *next = *(void**) ptr;
+            mem_free(ptr);
+            ptr = next;
+        }
+        pools[i] -> free_list = NULL;
+    }
+}
+
+
+// Gets the statistics of a pool.
+pool_stats_t pool_get_stats(pool_t *pool)
+{
+    return pool -> stats;
+}
+
+
+// Prints the statistics of every pool used so far to stderr, if they are
+// being counted.
+void pool_print_stats(void)
+{
+#ifdef POOL_STATS
+    for (size_t i = 1; i <= num_pools; i ++)
+    {
+        pool_stats_t stats = pools[i] -> stats;
+        fprintf(stderr, "%-12s allocated %zu reused %zu freed %zu live %zu peak %zu\n", pools[i] -> name,
+            stats.allocated, stats.reused, stats.freed, stats.live, stats.peak);
+    }
+#endif
+}
+
+
+// Allocates scratch memory that stays valid until the next frame_reset().
+void *frame_alloc(size_t size)
+{
+    if (frame_arena == NULL) {frame_arena = arena_init(FRAME_ARENA_BLOCK);}
+    return arena_alloc(frame_arena, size);
+}
+
+
+// Takes back all scratch memory.
+void frame_reset(void)
+{
+    if (frame_arena != NULL) {arena_reset(frame_arena);}
+}
@@ -220,6 +220,7 @@ void text_directions()
     sdl_render(); 
     double dt = 0;
     scene_t* scene = scene_init();
+    sdl_camera_reset(); // cutscenes fill the window
     add_background(scene, (vector_t) {1000, 500}, CUTSCENE8);
     sdl_on_key((key_handler_t) cutscenes_on_key);
     // While loop that can either be skipped or cycles through the opening scenes
@@ -247,6 +248,7 @@ void opening_story()
     sdl_render(); 
     double dt = 0;
     scene_t* scene = scene_init();
+    sdl_camera_reset(); // cutscenes fill the window
     add_background(scene, (vector_t) {1000, 500}, CUTSCENE1);
     sdl_on_key((key_handler_t) cutscenes_on_key);
     // While loop that can either be skipped or cycles through the opening scenes
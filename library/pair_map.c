@@ -0,0 +1,178 @@
+#include "pair_map.h"
+#include "memory.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+// The map is resized once it is more than half full.
+const size_t PAIR_MAP_RESIZE_FACTOR = 2;
+
+
+// A single slot of the map. A slot is empty if its value is NULL.
+typedef struct pair_entry
+{
+    uintptr_t lo;
+    uintptr_t hi;
+    void *value;
+} pair_entry_t;
+
+
+// Definition of the pair map struct. Uses open addressing with linear probing,
+// and the capacity is always a power of two.
+typedef struct pair_map
+{
+    size_t size;
+    size_t capacity;
+    pair_entry_t *entries;
+} pair_map_t;
+
+
+// Orders the two pointers of a pair so (a, b) and (b, a) give the same key.
+void pair_key(void *a, void *b, uintptr_t *lo, uintptr_t *hi)
+{
+    uintptr_t x = (uintptr_t) a;
+    uintptr_t y = (uintptr_t) b;
+    *lo = (x < y) ? x : y;
+    *hi = (x < y) ? y : x;
+}
+
+
+// Mixes the two halves of a key into a slot index.
+size_t pair_hash(uintptr_t lo, uintptr_t hi, size_t capacity)
+{
+    uint64_t h = (uint64_t) lo * 0x9E3779B97F4A7C15ULL;
+    h ^= (uint64_t) hi + 0x7F4A7C159E3779B9ULL + (h << 6) + (h >> 2);
+    h ^= h >> 31;
+    return (size_t) (h & (capacity - 1));
+}
+
+
+// Allocates memory for an empty pair map.
+pair_map_t *pair_map_init(size_t initial_size)
+{
+    pair_map_t *map = mem_alloc(sizeof(pair_map_t));
+    assert(map != NULL);
+
+    // Round the capacity up to a power of two with room for initial_size
+    // entries.
+    size_t capacity = 8;
+    while (capacity < PAIR_MAP_RESIZE_FACTOR * initial_size) {capacity *= 2;}
+
+    map -> size = 0;
+    map -> capacity = capacity;
+    map -> entries = mem_calloc(capacity, sizeof(pair_entry_t));
+    assert(map -> entries != NULL);
+
+    return map;
+}
+
+
+// Releases the memory allocated for a pair map.
+void pair_map_free(pair_map_t *map)
+{
+    mem_free(map -> entries);
+    mem_free(map);
+}
+
+
+// Finds the slot holding the key, or the empty slot where it would go.
+size_t pair_map_find(pair_map_t *map, uintptr_t lo, uintptr_t hi)
+{
+    size_t mask = map -> capacity - 1;
+    size_t i = pair_hash(lo, hi, map -> capacity);
+    while (map -> entries[i].value != NULL)
+    {
+        if (map -> entries[i].lo == lo && map -> entries[i].hi == hi) {return i;}
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+
+// Doubles the capacity of the map and re-inserts every entry.
+void pair_map_resize(pair_map_t *map)
+{
+    pair_entry_t *old = map -> entries;
+    size_t old_capacity = map -> capacity;
+
+    // The map grows within the arena it came from, whichever one is current.
+    map -> capacity *= PAIR_MAP_RESIZE_FACTOR;
+    map -> entries = mem_alloc_from(mem_owner(map), map -> capacity * sizeof(pair_entry_t));
+    assert(map -> entries != NULL);
+    memset(map -> entries, 0, map -> capacity * sizeof(pair_entry_t));
+
+    for (size_t i = 0; i < old_capacity; i ++)
+    {
+        if (old[i].value == NULL) {continue;}
+        map -> entries[pair_map_find(map, old[i].lo, old[i].hi)] = old[i];
+    }
+    mem_free(old);
+}
+
+
+// Gets the value stored for the pair (a, b).
+void *pair_map_get(pair_map_t *map, void *a, void *b)
+{
+    uintptr_t lo, hi;
+    pair_key(a, b, &lo, &hi);
+    return map -> entries[pair_map_find(map, lo, hi)].value;
+}
+
+
+// Stores a value for the pair (a, b).
+void pair_map_put(pair_map_t *map, void *a, void *b, void *value)
+{
+    assert(value != NULL);
+    if (PAIR_MAP_RESIZE_FACTOR * (map -> size + 1) > map -> capacity) {pair_map_resize(map);}
+
+    uintptr_t lo, hi;
+    pair_key(a, b, &lo, &hi);
+    size_t i = pair_map_find(map, lo, hi);
+    if (map -> entries[i].value == NULL) {map -> size ++;}
+    map -> entries[i] = (pair_entry_t) {lo, hi, value};
+}
+
+
+// Removes the entry for the pair (a, b) and returns its value.
+void *pair_map_remove(pair_map_t *map, void *a, void *b)
+{
+    uintptr_t lo, hi;
+    pair_key(a, b, &lo, &hi);
+    size_t mask = map -> capacity - 1;
+    size_t i = pair_map_find(map, lo, hi);
+    void *value = map -> entries[i].value;
+    if (value == NULL) {return NULL;}
+
+    // Shift later entries of the probe sequence back so no lookup is cut
+    // short by the hole.
+    size_t j = i;
+    while (true)
+    {
+        map -> entries[i].value = NULL;
+        while (true)
+        {
+            j = (j + 1) & mask;
+            if (map -> entries[j].value == NULL)
+            {
+                map -> size --;
+                return value;
+            }
+            size_t home = pair_hash(map -> entries[j].lo, map -> entries[j].hi, map -> capacity);
+            // Only move the entry if its home slot is not between the hole
+            // and its current slot (cyclically).
+            bool between = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!between) {break;}
+        }
+        map -> entries[i] = map -> entries[j];
+        i = j;
+    }
+}
+
+
+// Gets the number of entries in the map.
+size_t pair_map_size(pair_map_t *map)
+{
+    return map -> size;
+}
@@ -1,28 +1,138 @@
 #include "scene.h"
+#include "broadphase.h"
+#include "pair_map.h"
+#include "tile_grid.h"
+#include "collision.h"
+
+#include <math.h>
 
 const int INITIAL_SIZE = 10;
+// The simulation runs at a fixed 120 ticks per second.
+const double SCENE_TIMESTEP = 1.0 / 120;
+const int SCENE_MAX_STEPS = 8;
+// Scenes carve their memory out of blocks of this many bytes.
+const size_t SCENE_ARENA_BLOCK = 64 * 1024;
+// Bodies further than this from every player along x are put to sleep. The
+// camera shows 500 on either side of the player, so bodies wake up well before
+// they come into view.
+const double SCENE_ACTIVITY_MARGIN = 1000;
+// Which bodies are asleep is worked out again every this many ticks.
+const size_t SCENE_ACTIVITY_PERIOD = 8;
+// A body that moves further than this along x or y in a tick is swept against
+// the static bodies it collides with. Slower ones cannot skip past a platform,
+// and at the default tick nothing moves this fast.
+const double SCENE_SWEEP_DISTANCE = 5;
+// A swept body is stopped this far inside what it hit, so the collision
+// handlers see the contact in the next tick. It is also how much the body is
+// shrunk by while it is swept, which has to be more than what a body resting
+// on a block sinks into it (see MIN_OVERLAP in gameplay.c), or walking onto
+// the next block would count as running into it.
+const double SCENE_SWEEP_SKIN = 0.5;
 // We can use NUM_ROLES instead of having accessor functions, because we will 
 // know the size of the bodies list beforehand. NUM_ROLES is in sprite.c. 
 
+// The collision interactions between a pair of bodies, along with what the
+// narrow phase found between them, which they all share.
+typedef struct scene_contact
+{
+    // The collision is worked out in this order.
+    body_t *body1;
+    body_t *body2;
+    // Owned by the interactions list.
+    list_t *interactions;
+    collision_info_t collision;
+    // The tick the collision was last worked out in, and whether the bodies
+    // were touching then and the time before.
+    size_t tick;
+    bool touching;
+    bool was_touching;
+} scene_contact_t;
+
+
+// Contacts come and go as bodies are streamed in and out.
+pool_t SCENE_CONTACT_POOL = POOL_INIT("contact", scene_contact_t);
+
+
 // A collection of scene_list.
 typedef struct scene
 {
+    // Everything that lives as long as the scene is carved from this arena,
+    // including the scene itself.
+    arena_t *arena;
+    // The number of bodies, interactions and aux values added to the scene
+    // that did not come from its arena. Unless there are some, freeing the
+    // arena frees the whole scene.
+    size_t foreign;
+
     // A list of force_creator_t functions, which correspond to a interaction in the
     // interactions list according to index.
     list_t *interactions;
     list_t *scene_list;
+    // The same bodies as scene_list, split by whether they can move, so a tick
+    // only has to integrate the bodies that can. Neither owns the bodies.
+    list_t *moving;
+    list_t *statics;
+    // How far from the players bodies are kept awake.
+    double activity_margin;
+    // Told about every body before it is freed.
+    remove_handler_t remove_handler;
+    void *remove_aux;
+    // Removed interactions leave a NULL in the interactions list, which is
+    // compacted once enough of them pile up.
+    size_t removed_interactions;
+    // Bodies taken out of the scene at the end of a tick, waiting to be freed.
+    // Reused from tick to tick; does not own the bodies.
+    list_t *removed;
+    // The bodies marked for removal since the last tick (see
+    // body_set_remove_list()), so no list of bodies is looked through to find
+    // them.
+    list_t *marked;
+    // The moving bodies that are awake, and the interactions that are not
+    // asleep (see scene_interaction_asleep()), which are all a tick looks at.
+    // Both are worked out again by scene_update_activity(), and what is added
+    // in between joins them right away. Removed interactions leave a NULL in
+    // the active list.
+    list_t *awake;
+    list_t *active;
 
-    // The max and min values of the scene.
+    // The corners of the region the level takes up (see scene_set_bounds()).
     vector_t min;
     vector_t max;
+
+    // Finds the bodies which are close to each other each tick.
+    broadphase_t *broadphase;
+    // Where the static bodies are filed instead of the broad phase, or NULL
+    // (see scene_use_tile_grid()). What it finds for a body goes in found,
+    // which is reused from query to query.
+    tile_grid_t *grid;
+    list_t *found;
+    // Maps a pair of bodies to their contact (see scene_contact_t), whose
+    // interactions are only run while the broad phase reports the pair or the
+    // bodies are touching.
+    pair_map_t *contacts;
+    // The handlers to run between types of bodies. The interactions between
+    // two bodies are created from it once the broad phase finds them close.
+    // NULL until a handler is added.
+    dispatch_t *dispatch;
+    // The number of ticks so far, used to mark which collision interactions
+    // should run this tick.
+    size_t tick;
+
+    // Real time that has passed but not been simulated yet.
+    double accumulator;
+    double alpha;
+    double timestep;
 } scene_t;
 
 
 // Allocates memory for an empty scene.
 scene_t *scene_init(void)
 {
-    scene_t *scene = malloc(sizeof(scene_t));
-    assert(scene != NULL);
+    arena_t *arena = arena_init(SCENE_ARENA_BLOCK);
+    arena_t *previous = mem_use_arena(arena);
+    scene_t *scene = mem_alloc(sizeof(scene_t));
+    scene -> arena = arena;
+    scene -> foreign = 0;
 
     scene -> scene_list = list_init(INITIAL_SIZE, (free_func_t) list_free);
     for(size_t i = 0; i < NUM_ROLES; i++)
@@ -34,7 +144,30 @@ scene_t *scene_init(void)
     // The force creators are just pointers to functions; no special free_func
     // needed.
     scene -> interactions = list_init(INITIAL_SIZE, (free_func_t) interaction_free);
+    scene -> removed_interactions = 0;
+    scene -> removed = list_init(INITIAL_SIZE, NULL);
+    scene -> marked = list_init(INITIAL_SIZE, NULL);
+    scene -> awake = list_init(INITIAL_SIZE, NULL);
+    scene -> active = list_init(INITIAL_SIZE, NULL);
+    scene -> moving = list_init(INITIAL_SIZE, NULL);
+    scene -> statics = list_init(INITIAL_SIZE, NULL);
+    scene -> activity_margin = SCENE_ACTIVITY_MARGIN;
+    scene -> min = VEC_ZERO;
+    scene -> max = VEC_ZERO;
+    scene -> remove_handler = NULL;
+    scene -> remove_aux = NULL;
 
+    scene -> broadphase = broadphase_init(INITIAL_SIZE);
+    scene -> grid = NULL;
+    scene -> found = list_init(INITIAL_SIZE, NULL);
+    scene -> contacts = pair_map_init(INITIAL_SIZE);
+    scene -> dispatch = NULL;
+    scene -> tick = 0;
+    scene -> accumulator = 0;
+    scene -> alpha = 1;
+    scene -> timestep = SCENE_TIMESTEP;
+
+    mem_use_arena(previous);
     return scene;
 }
 
@@ -42,10 +175,204 @@ scene_t *scene_init(void)
 // Releases memory allocated for a given scene and all its scene_list.
 void scene_free(scene_t *scene)
 {
+    arena_t *arena = scene -> arena;
+    if (scene -> foreign == 0)
+    {
+        arena_free(arena);
+        pool_clear();
+        return;
+    }
+
+    // Some objects came from the heap, so every object has to be freed one by
+    // one. Freeing memory that came from the arena does nothing.
+    // The contacts do not own their interactions, so they are freed before
+    // the interactions themselves.
+    scene_compact_interactions(scene);
+    size_t size = list_size(scene -> interactions);
+    for (size_t i = 0; i < size; i ++)
+    {
+        scene_remove_contact(scene, list_get(scene -> interactions, i));
+    }
+    pair_map_free(scene -> contacts);
+    broadphase_free(scene -> broadphase);
+    if (scene -> grid != NULL) {tile_grid_free(scene -> grid);}
+    list_free(scene -> found);
+    if (scene -> dispatch != NULL) {dispatch_free(scene -> dispatch);}
+
     list_free(scene -> interactions);
     list_free(scene -> scene_list);
+    list_free(scene -> removed);
+    list_free(scene -> marked);
+    list_free(scene -> awake);
+    list_free(scene -> active);
+    list_free(scene -> moving);
+    list_free(scene -> statics);
+
+    mem_free(scene);
+    arena_free(arena);
+    pool_clear();
+}
+
+
+// Registers the function told about every body the scene removes.
+void scene_set_remove_handler(scene_t *scene, remove_handler_t handler, void *aux)
+{
+    scene -> remove_handler = handler;
+    scene -> remove_aux = aux;
+}
+
+
+// Gets the bodies of the scene that never move.
+list_t *scene_get_statics(scene_t *scene)
+{
+    return scene -> statics;
+}
+
+
+// Sets how far from the players bodies are kept awake, and wakes up or puts to
+// sleep the bodies right away.
+void scene_set_activity_margin(scene_t *scene, double margin)
+{
+    assert(margin >= 0);
+    scene -> activity_margin = margin;
+    scene_update_activity(scene);
+}
+
+
+// Sets the length of the ticks scene_advance() runs.
+void scene_set_timestep(scene_t *scene, double timestep)
+{
+    assert(timestep > 0);
+    scene -> timestep = timestep;
+}
+
+
+// Sets the corners of the region the level takes up.
+void scene_set_bounds(scene_t *scene, vector_t min, vector_t max)
+{
+    assert(min.x <= max.x && min.y <= max.y);
+    scene -> min = min;
+    scene -> max = max;
+}
+
+
+// Files the static bodies added from now on in a tile grid.
+void scene_use_tile_grid(scene_t *scene, double cell_size)
+{
+    assert(scene -> grid == NULL && list_size(scene -> statics) == 0);
+    arena_t *previous = mem_use_arena(scene -> arena);
+    scene -> grid = tile_grid_init(cell_size);
+    mem_use_arena(previous);
+}
+
+
+// Returns whether none of the bodies of an interaction can move.
+bool scene_interaction_fixed(interaction_t *interaction)
+{
+    list_t *bodies = interaction_get_bodies(interaction);
+    size_t num_bodies = list_size(bodies);
+    for (size_t i = 0; i < num_bodies; i ++)
+    {
+        if (!body_is_static(list_get(bodies, i))) {return false;}
+    }
+    return true;
+}
+
+
+// Adds an interaction to the interactions the scene runs each tick.
+void scene_activate(scene_t *scene, interaction_t *interaction)
+{
+    interaction_set_active(interaction, list_size(scene -> active));
+    list_add(scene -> active, interaction);
+}
+
+
+// Returns whether an interaction only involves bodies that are asleep or
+// static, with at least one of them asleep, so running it can wait until they
+// wake up.
+bool scene_interaction_asleep(interaction_t *interaction)
+{
+    list_t *bodies = interaction_get_bodies(interaction);
+    size_t num_bodies = list_size(bodies);
+    bool any_asleep = false;
+    for (size_t i = 0; i < num_bodies; i ++)
+    {
+        body_t *body = list_get(bodies, i);
+        if (body_is_asleep(body)) {any_asleep = true;}
+        else if (!body_is_static(body)) {return false;}
+    }
+    return any_asleep;
+}
+
+
+// Puts to sleep the bodies that are too far from every player, and wakes up
+// the ones that came back in range. Only the centroids are compared, which is
+// close enough given how wide the margin is. The interactions to run are then
+// gathered from the bodies left awake.
+void scene_update_activity(scene_t *scene)
+{
+    list_t *players = scene_get_list(scene, PLAYER);
+    size_t num_players = list_size(players);
+    while (list_size(scene -> awake) > 0) {list_swap_remove(scene -> awake, list_size(scene -> awake) - 1);}
+    size_t num_moving = list_size(scene -> moving);
+    for (size_t i = 0; i < num_moving; i ++)
+    {
+        body_t *body = list_get(scene -> moving, i);
+        double x = body_get_centroid(body).x;
+        // Without a player to measure from (e.g. in a menu), nothing sleeps.
+        bool asleep = num_players > 0;
+        for (size_t j = 0; j < num_players && asleep; j ++)
+        {
+            double distance = fabs(x - body_get_centroid(list_get(players, j)).x);
+            if (distance <= scene -> activity_margin) {asleep = false;}
+        }
+        body_set_asleep(body, asleep);
+        if (!asleep) {list_add(scene -> awake, body);}
+    }
+
+    // Interactions between bodies that never move never sleep, so they stay.
+    size_t num_active = list_size(scene -> active);
+    for (size_t i = 0; i < num_active; i ++)
+    {
+        interaction_t *interaction = list_get(scene -> active, i);
+        if (interaction == NULL || scene_interaction_fixed(interaction)) {continue;}
+        interaction_set_active(interaction, INTERACTION_INACTIVE);
+        list_set(scene -> active, i, NULL);
+    }
+    list_compact(scene -> active);
+    for (size_t i = 0; i < list_size(scene -> active); i ++)
+    {
+        interaction_set_active(list_get(scene -> active, i), i);
+    }
 
-    free(scene);
+    // Every other interaction that is not asleep has a body that is awake.
+    size_t num_awake = list_size(scene -> awake);
+    for (size_t i = 0; i < num_awake; i ++)
+    {
+        list_t *interactions = body_get_interactions(list_get(scene -> awake, i));
+        size_t num_interactions = list_size(interactions);
+        for (size_t j = 0; j < num_interactions; j ++)
+        {
+            interaction_t *interaction = list_get(interactions, j);
+            if (interaction_get_active(interaction) == INTERACTION_INACTIVE) {scene_activate(scene, interaction);}
+        }
+    }
+}
+
+
+// Gets the arena the scene's objects are carved from.
+arena_t *scene_get_arena(scene_t *scene)
+{
+    return scene -> arena;
+}
+
+
+// Counts an object handed to the scene if freeing the scene's arena would not
+// free it.
+void scene_check_owner(scene_t *scene, void *object, free_func_t freer)
+{
+    if (freer == NULL) {return;}
+    if (freer != mem_free || mem_owner(object) != scene -> arena) {scene -> foreign ++;}
 }
 
 // CAN WE SWITCH THIS SO THAT THE ROLE COMES BEFORE THE INDEX?
@@ -74,9 +401,50 @@ size_t scene_size(scene_t *scene)
     return body_count;
 }
 
+
+// Gets how far the scene is into its next tick.
+double scene_get_alpha(scene_t *scene)
+{
+    return scene -> alpha;
+}
+
+
+// Gets the length of the scene's ticks.
+double scene_get_timestep(scene_t *scene)
+{
+    return scene -> timestep;
+}
+
+
+// Gets the bottom-left corner of the region the level takes up.
+vector_t scene_get_min(scene_t *scene)
+{
+    return scene -> min;
+}
+
+
+// Gets the top-right corner of the region the level takes up.
+vector_t scene_get_max(scene_t *scene)
+{
+    return scene -> max;
+}
+
+
 // Adds a body to a scene. The role acts as the index for that types list index
 void scene_add_body(scene_t *scene, body_t *body, size_t index)
 {
+    scene_check_owner(scene, body, mem_free);
+    arena_t *previous = mem_use_arena(scene -> arena);
+
+    // Backgrounds never collide with anything.
+    bool filed = (scene -> grid != NULL && body_is_static(body));
+    if (index != BACKGROUND && filed) {tile_grid_add(scene -> grid, body);}
+    else if (index != BACKGROUND) {broadphase_add(scene -> broadphase, body);}
+    list_add(body_is_static(body) ? scene -> statics : scene -> moving, body);
+    if (!body_is_static(body) && !body_is_asleep(body)) {list_add(scene -> awake, body);}
+    body_set_remove_list(body, scene -> marked);
+    if (body_is_removed(body)) {list_add(scene -> marked, body);}
+
     if(list_size(scene -> scene_list) <= index)
     {
         list_add(scene -> scene_list, list_init(INITIAL_SIZE, (free_func_t) body_free));
@@ -86,6 +454,7 @@ void scene_add_body(scene_t *scene, body_t *body, size_t index)
     {
         list_add(list_get(scene -> scene_list, index), body); 
     }
+    mem_use_arena(previous);
 }
 
 
@@ -94,22 +463,303 @@ void scene_remove_body(scene_t *scene, size_t index, size_t role)
 {
     // Note that error handling is done in the list_remove function.
     body_t *old = list_remove(list_get(scene -> scene_list, role), index);
+    list_t *kind_list = body_is_static(old) ? scene -> statics : scene -> moving;
+    for (size_t i = 0; i < list_size(kind_list); i ++)
+    {
+        if (list_get(kind_list, i) == old) {list_remove(kind_list, i); break;}
+    }
+    for (size_t i = 0; i < list_size(scene -> awake); i ++)
+    {
+        if (list_get(scene -> awake, i) == old) {list_remove(scene -> awake, i); break;}
+    }
+    for (size_t i = 0; i < list_size(scene -> marked); i ++)
+    {
+        if (list_get(scene -> marked, i) == old) {list_swap_remove(scene -> marked, i); break;}
+    }
     scene_remove_interactions(scene, old);
+    // Mirrors where scene_add_body() filed the body.
+    bool filed = (scene -> grid != NULL && body_is_static(old));
+    if (role != BACKGROUND && filed) {tile_grid_remove(scene -> grid, old);}
+    else if (role != BACKGROUND) {broadphase_remove(scene -> broadphase, old);}
+    if (scene -> remove_handler != NULL) {scene -> remove_handler(scene -> remove_aux, old);}
     body_free(old);
 }
 
 
+// Adds an interaction to the scene and to the interaction list of each of its
+// bodies.
+void scene_add_interaction(scene_t *scene, interaction_t *interaction)
+{
+    interaction_set_index(interaction, list_size(scene -> interactions));
+    list_add(scene -> interactions, interaction);
+    if (!scene_interaction_asleep(interaction)) {scene_activate(scene, interaction);}
+
+    size_t size = list_size(interaction_get_bodies(interaction));
+    for (size_t j = 0; j < size; j ++)
+    {
+        list_t *body_interactions = body_get_interactions(interaction_get_body(interaction, j));
+        interaction_set_link(interaction, j, list_size(body_interactions));
+        list_add(body_interactions, interaction);
+    }
+}
+
+
+// Removes an interaction from the interaction list of each of its bodies, and
+// frees it. Its slot in the scene's list is left NULL until the list is
+// compacted.
+void scene_remove_interaction(scene_t *scene, interaction_t *interaction)
+{
+    // Bodies that were touching come apart when either is removed, so handlers
+    // get to undo what they did on contact (e.g. let go of a side they held).
+    if (interaction_is_on_contact(interaction) && interaction_is_touching(interaction))
+    {
+        interaction_set_contact(interaction, CONTACT_END, interaction_get_collision(interaction));
+        interaction_get_forcer(interaction)(interaction);
+    }
+
+    size_t size = list_size(interaction_get_bodies(interaction));
+    for (size_t j = 0; j < size; j ++)
+    {
+        body_t *body = interaction_get_body(interaction, j);
+        list_t *body_interactions = body_get_interactions(body);
+        size_t link = interaction_get_link(interaction, j);
+        list_swap_remove(body_interactions, link);
+        if (link == list_size(body_interactions)) {continue;}
+
+        // The last interaction of the body was moved into the hole, so update
+        // where it is stored.
+        interaction_t *moved = list_get(body_interactions, link);
+        size_t moved_size = list_size(interaction_get_bodies(moved));
+        for (size_t k = 0; k < moved_size; k ++)
+        {
+            if (interaction_get_body(moved, k) == body
+                && interaction_get_link(moved, k) == list_size(body_interactions))
+            {
+                interaction_set_link(moved, k, link);
+                break;
+            }
+        }
+    }
+
+    scene_remove_contact(scene, interaction);
+    list_set(scene -> interactions, interaction_get_index(interaction), NULL);
+    size_t active = interaction_get_active(interaction);
+    if (active != INTERACTION_INACTIVE) {list_set(scene -> active, active, NULL);}
+    interaction_free(interaction);
+    scene -> removed_interactions ++;
+}
+
+
+// Drops the NULL slots left in the interactions list by removed interactions.
+void scene_compact_interactions(scene_t *scene)
+{
+    if (scene -> removed_interactions == 0) {return;}
+
+    list_compact(scene -> interactions);
+    size_t size = list_size(scene -> interactions);
+    for (size_t i = 0; i < size; i ++)
+    {
+        interaction_set_index(list_get(scene -> interactions, i), i);
+    }
+    scene -> removed_interactions = 0;
+}
+
+
 // Adds a force creator to a scene,
 // The auxiliary value is passed to the force creator each time it is called.
 // The force creator is registered with a list of bodies it applies to,
 // so it can be removed when any one of the bodies  is removed.
 void scene_add_bodies_force_creator(scene_t *scene, force_creator_t forcer, void *aux, list_t *bodies, free_func_t aux_freer)
 {
+    scene_check_owner(scene, bodies, mem_free);
+    scene_check_owner(scene, aux, aux_freer);
+    arena_t *previous = mem_use_arena(scene -> arena);
     // Create a interaction which corresponds to a force interaction between the inputted
     // bodies.
     interaction_t *interaction = interaction_init(bodies, aux, aux_freer, forcer);
     // Add the interaction to the scene.
-    list_add(scene -> interactions, interaction);
+    scene_add_interaction(scene, interaction);
+    mem_use_arena(previous);
+}
+
+
+// Adds a force creator between two bodies which only has an effect while they
+// are touching. It is only invoked during the ticks in which the broad phase
+// finds the bodies close to each other, or while they are still touching (see
+// interaction_is_touching()), so it gets told when they come apart.
+void scene_add_collision_force_creator(scene_t *scene, force_creator_t forcer, void *aux, list_t *bodies, free_func_t aux_freer)
+{
+    assert(list_size(bodies) == 2);
+    scene_check_owner(scene, bodies, mem_free);
+    scene_check_owner(scene, aux, aux_freer);
+    arena_t *previous = mem_use_arena(scene -> arena);
+    interaction_t *interaction = interaction_init(bodies, aux, aux_freer, forcer);
+    interaction_set_on_contact(interaction, true);
+    scene_add_interaction(scene, interaction);
+
+    body_t *body1 = list_get(bodies, 0);
+    body_t *body2 = list_get(bodies, 1);
+    scene_contact_t *contact = pair_map_get(scene -> contacts, body1, body2);
+    if (contact == NULL)
+    {
+        contact = pool_alloc(&SCENE_CONTACT_POOL);
+        *contact = (scene_contact_t) {body1, body2, list_init(1, NULL), {0}, 0, false, false};
+        pair_map_put(scene -> contacts, body1, body2, contact);
+    }
+    list_add(contact -> interactions, interaction);
+    mem_use_arena(previous);
+}
+
+
+// Registers a collision handler between two types of bodies.
+void scene_add_pair_handler(scene_t *scene, role_t role1, subrole_t subrole1, role_t role2, subrole_t subrole2,
+    force_creator_t handler, void *aux)
+{
+    arena_t *previous = mem_use_arena(scene -> arena);
+    if (scene -> dispatch == NULL) {scene -> dispatch = dispatch_init();}
+    dispatch_add(scene -> dispatch, role1, subrole1, role2, subrole2, handler, aux);
+    mem_use_arena(previous);
+}
+
+
+// Creates the collision interactions between two bodies the broad phase just
+// found close to each other for the first time, from the handlers registered
+// for their types. Returns their contact, or NULL if there are none.
+scene_contact_t *scene_dispatch_pair(scene_t *scene, body_t *body1, body_t *body2)
+{
+    if (scene -> dispatch == NULL) {return NULL;}
+    dispatch_match_t matches[DISPATCH_MAX_MATCHES];
+    size_t num_matches = dispatch_find(scene -> dispatch, body1, body2, matches, DISPATCH_MAX_MATCHES);
+    for (size_t i = 0; i < num_matches; i ++)
+    {
+        list_t *bodies = list_init(2, NULL);
+        list_add(bodies, matches[i].swapped ? body2 : body1);
+        list_add(bodies, matches[i].swapped ? body1 : body2);
+        scene_add_collision_force_creator(scene, matches[i].handler, matches[i].aux, bodies, NULL);
+    }
+    return (num_matches > 0) ? pair_map_get(scene -> contacts, body1, body2) : NULL;
+}
+
+
+// Removes a collision interaction from the list of its pair of bodies.
+void scene_remove_contact(scene_t *scene, interaction_t *interaction)
+{
+    if (!interaction_is_on_contact(interaction)) {return;}
+
+    body_t *body1 = interaction_get_body(interaction, 0);
+    body_t *body2 = interaction_get_body(interaction, 1);
+    scene_contact_t *contact = pair_map_get(scene -> contacts, body1, body2);
+    if (contact == NULL) {return;}
+
+    list_t *interactions = contact -> interactions;
+    for (size_t i = 0; i < list_size(interactions); i ++)
+    {
+        if (list_get(interactions, i) == interaction)
+        {
+            list_remove(interactions, i);
+            break;
+        }
+    }
+    if (list_size(interactions) == 0)
+    {
+        pair_map_remove(scene -> contacts, body1, body2);
+        list_free(interactions);
+        pool_free(&SCENE_CONTACT_POOL, contact);
+    }
+}
+
+
+// Tells a collision interaction what happened between its bodies this tick.
+// The narrow phase is only run once per contact and tick, however many
+// interactions the two bodies share.
+void scene_narrow_phase(scene_t *scene, interaction_t *interaction)
+{
+    body_t *body1 = interaction_get_body(interaction, 0);
+    scene_contact_t *contact = pair_map_get(scene -> contacts, body1, interaction_get_body(interaction, 1));
+    assert(contact != NULL);
+    if (contact -> tick != scene -> tick)
+    {
+        contact -> was_touching = contact -> touching;
+        contact -> collision = find_collision(contact -> body1, contact -> body2);
+        contact -> touching = contact -> collision.collided;
+        contact -> tick = scene -> tick;
+    }
+
+    contact_event_t event = CONTACT_NONE;
+    if (contact -> touching) {event = contact -> was_touching ? CONTACT_STAY : CONTACT_BEGIN;}
+    else if (contact -> was_touching) {event = CONTACT_END;}
+    collision_info_t collision = contact -> collision;
+    if (body1 != contact -> body1) {collision = collision_flip(collision);}
+    // When the bodies come apart, handlers still get the last collision they had.
+    if (event == CONTACT_END) {collision = interaction_get_collision(interaction);}
+    interaction_set_contact(interaction, event, collision);
+}
+
+
+// Stops a body that moved far in its last tick (from start to where it is now)
+// at the first static body in the way it collides with, instead of letting it
+// pass through. Bodies it was already touching at the start are left to the
+// collision handlers.
+void scene_sweep(scene_t *scene, body_t *body, vector_t start)
+{
+    vector_t displacement = vec_subtract(body_get_centroid(body), start);
+    if (fabs(displacement.x) <= SCENE_SWEEP_DISTANCE && fabs(displacement.y) <= SCENE_SWEEP_DISTANCE) {return;}
+    if (scene -> dispatch == NULL || body_get_kind(body) != BODY_DYNAMIC) {return;}
+
+    extrema_t end = body_get_extrema(body);
+    extrema_t from = {end.min_x - displacement.x, end.max_x - displacement.x,
+        end.min_y - displacement.y, end.max_y - displacement.y};
+    // Everything the body went past is inside this box.
+    extrema_t path = {fmin(from.min_x, end.min_x), fmax(from.max_x, end.max_x),
+        fmin(from.min_y, end.min_y), fmax(from.max_y, end.max_y)};
+
+    // With a tile grid, only the solids under the cells of the path are
+    // looked at.
+    list_t *solids = scene -> statics;
+    if (scene -> grid != NULL)
+    {
+        tile_grid_query(scene -> grid, path, scene -> found);
+        solids = scene -> found;
+    }
+
+    // Swept without its skin, so it only hits what it gets more than the skin
+    // into, and it is stopped the skin inside the first of those.
+    extrema_t core = {from.min_x + SCENE_SWEEP_SKIN, from.max_x - SCENE_SWEEP_SKIN,
+        from.min_y + SCENE_SWEEP_SKIN, from.max_y - SCENE_SWEEP_SKIN};
+    double first = 2;
+    size_t num_solids = list_size(solids);
+    for (size_t i = 0; i < num_solids; i ++)
+    {
+        body_t *solid = list_get(solids, i);
+        extrema_t box = body_get_extrema(solid);
+        if (box.min_x > path.max_x || path.min_x > box.max_x || box.min_y > path.max_y || path.min_y > box.max_y) {continue;}
+        vector_t axis;
+        double t = find_time_of_impact(core, displacement, box, &axis);
+        if (t < 0 || t >= first) {continue;}
+        // Only what the body would react to stops it (e.g. players go through
+        // the invisible blocks that turn enemies around).
+        dispatch_match_t match;
+        if (dispatch_find(scene -> dispatch, body, solid, &match, 1) == 0) {continue;}
+        first = t;
+    }
+    if (first > 1) {return;}
+
+    // Back up to where the core first touches.
+    body_translate(body, vec_multiply(first - 1, displacement));
+}
+
+
+// Marks the collision interactions of a pair of bodies that are close enough
+// to touch to run this tick, creating them the first time the pair gets close.
+void scene_mark_pair(scene_t *scene, body_t *body1, body_t *body2)
+{
+    scene_contact_t *contact = pair_map_get(scene -> contacts, body1, body2);
+    if (contact == NULL) {contact = scene_dispatch_pair(scene, body1, body2);}
+    if (contact == NULL) {return;}
+    for (size_t j = 0; j < list_size(contact -> interactions); j ++)
+    {
+        interaction_set_tick(list_get(contact -> interactions, j), scene -> tick);
+    }
 }
 
 
@@ -117,71 +767,155 @@ void scene_add_bodies_force_creator(scene_t *scene, force_creator_t forcer, void
 // This requires executing all the force creators and then ticking each body (see body_tick()).
 void scene_tick(scene_t *scene, double dt)
 {
-    // Adds all the forces to the relevant scene_list.
-    size_t size_interactions = list_size(scene -> interactions);
-    for (size_t i = 0; i < size_interactions; i ++)
+    // Anything the interactions create during the tick belongs to the scene.
+    arena_t *previous = mem_use_arena(scene -> arena);
+    scene -> tick ++;
+    if (scene -> tick % SCENE_ACTIVITY_PERIOD == 1) {scene_update_activity(scene);}
+
+    // Only the bodies that are awake move this tick, so only they need their
+    // centroid saved.
+    size_t num_awake = list_size(scene -> awake);
+    for (size_t i = 0; i < num_awake; i ++)
+    {
+        body_save_centroid(list_get(scene -> awake, i));
+    }
+
+    // Mark the collision interactions of every pair of bodies that are close
+    // enough to touch.
+    broadphase_update(scene -> broadphase);
+    size_t num_pairs = broadphase_num_pairs(scene -> broadphase);
+    for (size_t i = 0; i < num_pairs; i ++)
     {
-        interaction_t *interaction = list_get(scene -> interactions, i);
+        body_pair_t pair = broadphase_get_pair(scene -> broadphase, i);
+        scene_mark_pair(scene, pair.body1, pair.body2);
+    }
+    // The static bodies in the tile grid are paired with each awake body
+    // from the cells it covers.
+    for (size_t i = 0; i < num_awake && scene -> grid != NULL; i ++)
+    {
+        body_t *body = list_get(scene -> awake, i);
+        if (body_is_removed(body)) {continue;}
+        tile_grid_query(scene -> grid, broadphase_box(body), scene -> found);
+        for (size_t j = 0; j < list_size(scene -> found); j ++)
+        {
+            scene_mark_pair(scene, body, list_get(scene -> found, j));
+        }
+    }
+
+    // Adds all the forces to the relevant scene_list. Interactions added from
+    // here on run from the next tick.
+    size_t num_active = list_size(scene -> active);
+    for (size_t i = 0; i < num_active; i ++)
+    {
+        interaction_t *interaction = list_get(scene -> active, i);
+        if (interaction == NULL) {continue;}
+        if (interaction_is_on_contact(interaction))
+        {
+            // Collision interactions of bodies that are far apart have nothing
+            // to do, unless the bodies were touching and just came apart.
+            if (interaction_get_tick(interaction) != scene -> tick && !interaction_is_touching(interaction)) {continue;}
+            scene_narrow_phase(scene, interaction);
+        }
         force_creator_t forcer = interaction_get_forcer(interaction);
         assert(forcer != NULL);
         // Apply the force to the interaction.
         forcer(interaction);
     }
 
-    // Tick each body.
-    // Use a while loop to avoid issues with iterating over a list whose length
-    // is changing.
+    // Push each body that is awake out of everything it ran into, now that all
+    // of its contacts are known, then tick it. Bodies marked for removal are
+    // skipped; they have added themselves to the marked list, and are removed
+    // all at once below.
+    for (size_t i = 0; i < num_awake; i ++)
+    {
+        body_t *body = (body_t*) list_get(scene -> awake, i);
+        if (body_is_removed(body)) {continue;}
+        body_resolve_contacts(body);
+        vector_t start = body_get_centroid(body);
+        body_tick(body, dt);
+        scene_sweep(scene, body, start);
+    }
+    if (list_size(scene -> marked) > 0) {scene_remove_marked(scene);}
+
+    // Only compact once a quarter of the list is holes, so removing bodies
+    // stays cheap on average.
+    if (4 * scene -> removed_interactions > list_size(scene -> interactions))
+    {
+        scene_compact_interactions(scene);
+    }
+    mem_use_arena(previous);
+}
+
+
+// Takes every body marked for removal out of the scene and frees it, along with
+// its interactions. Each role list is compacted in one pass, keeping the order
+// of the remaining bodies, since roles rely on it (e.g. PLAYER 0).
+void scene_remove_marked(scene_t *scene)
+{
+    if (list_size(scene -> marked) == 0) {return;}
+    // Only the lists of the kinds of bodies that were marked need compacting.
+    bool any_static = false;
+    bool any_moving = false;
+    while (list_size(scene -> marked) > 0)
+    {
+        body_t *body = list_swap_remove(scene -> marked, list_size(scene -> marked) - 1);
+        if (body_is_static(body)) {any_static = true;}
+        else {any_moving = true;}
+    }
+
     for (size_t role = 0; role < NUM_ROLES; role ++)
     {
-        size_t i = 0;
-        while (i < list_size(list_get(scene -> scene_list, role)))
-        {
-            body_t *body = (body_t*) list_get((list_t*) list_get(scene -> scene_list, role), i);
-            // Check to see if the body is marked for removal; if so, free the body
-            // and associated interactions.
-            if (body_is_removed(body))
-            {
-                // Remove interactions associated with a body.
-                scene_remove_interactions(scene, body);
-                body_free(list_remove(list_get(scene -> scene_list, role), i));
+        list_remove_if(list_get(scene -> scene_list, role), (predicate_t) body_is_removed, scene -> removed);
+    }
+    if (any_moving)
+    {
+        list_remove_if(scene -> moving, (predicate_t) body_is_removed, NULL);
+        list_remove_if(scene -> awake, (predicate_t) body_is_removed, NULL);
+    }
+    if (any_static) {list_remove_if(scene -> statics, (predicate_t) body_is_removed, NULL);}
+    broadphase_remove_marked(scene -> broadphase);
+    while (list_size(scene -> removed) > 0)
+    {
+        body_t *body = list_remove(scene -> removed, list_size(scene -> removed) - 1);
+        if (scene -> grid != NULL && body_is_static(body)) {tile_grid_remove(scene -> grid, body);}
+        scene_remove_interactions(scene, body);
+        if (scene -> remove_handler != NULL) {scene -> remove_handler(scene -> remove_aux, body);}
+        body_free(body);
+    }
+}
 
-            }
-            else
-            {
-                body_tick(body, dt);
-                i ++;
-            }
-        }
+
+// Advances the scene by the real time elapsed, in fixed ticks.
+double scene_advance(scene_t *scene, double dt)
+{
+    assert(dt >= 0);
+    scene -> accumulator += dt;
+    // Drop whatever time the step cap would leave behind.
+    double timestep = scene -> timestep;
+    if (scene -> accumulator > SCENE_MAX_STEPS * timestep)
+    {
+        scene -> accumulator = SCENE_MAX_STEPS * timestep;
     }
+
+    while (scene -> accumulator >= timestep)
+    {
+        scene_tick(scene, timestep);
+        scene -> accumulator -= timestep;
+    }
+
+    scene -> alpha = scene -> accumulator / timestep;
+    return scene -> alpha;
 }
 
 
 // Remove all interactions (i.e. force interactions) associated with the inputted
-// body from the scene.
+// body from the scene. Only looks at the body's own interactions.
 void scene_remove_interactions(scene_t *scene, body_t *body)
 {
-    // Use a while loop to avoid issues with iterating over a list whose size
-    // is changing.
-    int i = 0;
-    while (i < list_size(scene -> interactions))
+    list_t *body_interactions = body_get_interactions(body);
+    while (list_size(body_interactions) > 0)
     {
-        interaction_t *interaction = list_get(scene -> interactions, i);
-        // Check each body in the interaction for a match.
-        size_t size = list_size(interaction_get_bodies(interaction));
-        for (size_t j = 0; j < size; j ++)
-        {
-            body_t *another_body = interaction_get_body(interaction, j);
-            if (body == another_body)
-            {
-                // Make sure to free the interaction AND remove it from the interactions
-                // list.
-                interaction_free(list_remove(scene -> interactions, i));
-                // Move on to the next interaction.
-                i--;
-                break;
-            }
-        }
-        i ++;
+        scene_remove_interaction(scene, list_get(body_interactions, list_size(body_interactions) - 1));
     }
 }
 
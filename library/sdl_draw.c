@@ -1,4 +1,5 @@
 #include "sdl_draw.h"
+#include "memory.h"
 
 
 // Takes a texture, the role associated with the texture, and the list of
@@ -95,8 +96,9 @@ void sdl_write(TTF_Font* font,
     assert(surface != NULL);
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
 
-    // Get the position in pixel coordinates.
-    position = get_window_position(position, window_info);
+    // Get the position in pixel coordinates. Text does not scroll with the
+    // camera.
+    position = get_overlay_position(position, window_info);
 
     int width, height;
     SDL_QueryTexture(texture, NULL, NULL, &width, &height);
@@ -112,7 +114,7 @@ void sdl_write(TTF_Font* font,
 // Drawing sprites -----------------------------------------------------------------
 
 // Draws a sprite on the window.
-void sdl_draw_sprite(body_t* body, list_t* textures, list_t* frames, SDL_Renderer* renderer, window_info_t window_info)
+void sdl_draw_sprite(body_t* body, double alpha, list_t* textures, list_t* frames, SDL_Renderer* renderer, window_info_t window_info)
 {
     sprite_t* sprite = (sprite_t*) body_get_info(body);
     sprite_state_t state = sprite_get_state(sprite);
@@ -151,8 +153,9 @@ void sdl_draw_sprite(body_t* body, list_t* textures, list_t* frames, SDL_Rendere
     source_rect.w = frame.w;
     source_rect.h = frame.h;
 
-    // Note that this position is in pixels.
-    vector_t position = get_window_position(body_get_centroid(body), window_info);
+    // Note that this position is in pixels. Bodies are drawn between their
+    // last two ticks.
+    vector_t position = get_window_position(body_get_interpolated_centroid(body, alpha), window_info);
     // We will probably want to have a scaling factor for each sprite to make
     // them different sizes. This will likely be stored in the sprite struct.
     SDL_Rect dest_rect = {position.x - (frame.w / 2) + state.adjust.x,
@@ -167,7 +170,7 @@ void sdl_draw_sprite(body_t* body, list_t* textures, list_t* frames, SDL_Rendere
 void sdl_draw_shape(shape_t* shape, rgb_color_t color, SDL_Renderer* renderer, window_info_t window_info)
 {
     if (shape_type(shape) == CIRCLE) {sdl_draw_circle(shape, color, renderer, window_info);}
-    else if (shape_type(shape) == POLYGON) {sdl_draw_polygon(shape, color, renderer, window_info);}
+    else if (shape_type(shape) == POLYGON || shape_type(shape) == BOX) {sdl_draw_polygon(shape, color, renderer, window_info);}
 }
 
 
@@ -191,11 +194,11 @@ void sdl_draw_circle(shape_t* shape, rgb_color_t color, SDL_Renderer* renderer,
 // Draws a POLYGON shape_t object on the window.
 void sdl_draw_polygon(shape_t* shape, rgb_color_t color, SDL_Renderer* renderer, window_info_t window_info)
 {
-    list_t* vertices = shape_vertices(shape);
+    vector_t* vertices = shape_vertices(shape);
 
     // Check parameters.
-    assert(shape_type(shape) == POLYGON);
-    size_t n = list_size(vertices);
+    assert(shape_type(shape) == POLYGON || shape_type(shape) == BOX);
+    size_t n = shape_num_vertices(shape);
     assert(n >= 3);
     assert(0 <= color.r && color.r <= 1);
     assert(0 <= color.g && color.g <= 1);
@@ -203,18 +206,13 @@ void sdl_draw_polygon(shape_t* shape, rgb_color_t color, SDL_Renderer* renderer,
 
     // Convert each vertex to a point on screen.
     // x_points and y_points are simple integer arrays of n elements.
-    int16_t *x_vertices = malloc(sizeof(int16_t) * n);
-    int16_t *y_vertices = malloc(sizeof(int16_t) * n);
-    assert(x_vertices != NULL);
-    assert(y_vertices != NULL);
+    int16_t *x_vertices = frame_alloc(sizeof(int16_t) * n);
+    int16_t *y_vertices = frame_alloc(sizeof(int16_t) * n);
 
     for (size_t i = 0; i < n; i++)
     {
-        // Populate x_points and y_points.
-        vector_t *vertex = list_get(vertices, i);
-
         // Gets the position of the vertex in terms of the pixel coordinates.
-        vector_t pixel = get_window_position(*vertex, window_info);
+        vector_t pixel = get_window_position(vertices[i], window_info);
         x_vertices[i] = pixel.x;
         y_vertices[i] = pixel.y;
     }
@@ -224,9 +222,6 @@ void sdl_draw_polygon(shape_t* shape, rgb_color_t color, SDL_Renderer* renderer,
     // NOTE: The final parameter seems to control the opacity. We should add
     // functionality to color.h so that we can adjust this.
     filledPolygonRGBA(renderer, x_vertices, y_vertices, n, color.r * 255, color.g * 255, color.b * 255, 255);
-
-    free(x_vertices);
-    free(y_vertices);
 }
 
 
@@ -4,6 +4,9 @@ const char* WINDOW_TITLE = "SOUPer Maruchan Bros";
 const int WINDOW_WIDTH = 1000;
 const int WINDOW_HEIGHT = 500;
 
+// The camera follows its target once it leaves the middle half of the view.
+const double CAMERA_DEAD_ZONE = 0.5;
+
 
 // Stores window_info in the window_info_t struct. Returns 0 if initialization
 // was successful and 1 otherwise.
@@ -28,6 +31,7 @@ int window_info_init(vector_t min, vector_t max, window_info_t* window_info)
     window_info -> center = vec_multiply(0.5, vec_add(min, max));
     window_info -> max_diff = vec_subtract(max, window_info -> center);
     window_info -> scale = get_scene_scale(*window_info);
+    camera_reset(window_info);
 
     return 0;
 }
@@ -51,23 +55,76 @@ void window_info_free(window_info_t* window_info)
 // Computes the center of the window in pixel coordinates.
 vector_t get_window_center(SDL_Window* window)
 {
-    int *width = malloc(sizeof(int));
-    int *height = malloc(sizeof(int));
-    assert(width != NULL);
-    assert(height != NULL);
+    int width, height;
+    SDL_GetWindowSize(window, &width, &height);
+    vector_t dimensions = {width, height};
 
-    SDL_GetWindowSize(window, width, height);
-    vector_t dimensions = {*width, *height};
+    return vec_multiply(0.5, dimensions);
+}
 
-    free(width);
-    free(height);
 
-    return vec_multiply(0.5, dimensions);
+// Puts the camera back at the origin with no bounds. The dead zone spans the
+// middle of the view horizontally and the whole view vertically.
+void camera_reset(window_info_t* window_info)
+{
+    vector_t min = vec_subtract(window_info -> center, window_info -> max_diff);
+    vector_t max = vec_add(window_info -> center, window_info -> max_diff);
+    double margin = 0.5 * (1 - CAMERA_DEAD_ZONE) * (max.x - min.x);
+
+    camera_t* camera = &window_info -> camera;
+    camera -> offset = VEC_ZERO;
+    camera -> dead_min = (vector_t) {min.x + margin, min.y};
+    camera -> dead_max = (vector_t) {max.x - margin, max.y};
+    camera -> bound_min = min;
+    camera -> bound_max = max;
+    camera -> bounded = false;
+}
+
+
+// Stops the camera from scrolling past the given scene coordinates.
+void camera_set_bounds(vector_t min, vector_t max, window_info_t* window_info)
+{
+    assert(min.x <= max.x && min.y <= max.y);
+    window_info -> camera.bound_min = min;
+    window_info -> camera.bound_max = max;
+    window_info -> camera.bounded = true;
 }
 
 
-// Maps a scene coordinate to a window coordinate.
+// Scrolls the camera just enough to keep the target inside the dead zone, then
+// clamps the view to the bounds. Only the offset changes, so the cost does not
+// depend on the size of the scene.
+void camera_follow(vector_t target, window_info_t* window_info)
+{
+    camera_t* camera = &window_info -> camera;
+    vector_t view = vec_subtract(target, camera -> offset);
+
+    if (view.x < camera -> dead_min.x) {camera -> offset.x += view.x - camera -> dead_min.x;}
+    if (view.x > camera -> dead_max.x) {camera -> offset.x += view.x - camera -> dead_max.x;}
+    if (view.y < camera -> dead_min.y) {camera -> offset.y += view.y - camera -> dead_min.y;}
+    if (view.y > camera -> dead_max.y) {camera -> offset.y += view.y - camera -> dead_max.y;}
+
+    if (!camera -> bounded) {return;}
+
+    // If the bounds are narrower than the view, the right/top edge wins.
+    vector_t view_min = vec_subtract(window_info -> center, window_info -> max_diff);
+    vector_t view_max = vec_add(window_info -> center, window_info -> max_diff);
+    camera -> offset.x = fmax(camera -> offset.x, camera -> bound_min.x - view_min.x);
+    camera -> offset.x = fmin(camera -> offset.x, camera -> bound_max.x - view_max.x);
+    camera -> offset.y = fmax(camera -> offset.y, camera -> bound_min.y - view_min.y);
+    camera -> offset.y = fmin(camera -> offset.y, camera -> bound_max.y - view_max.y);
+}
+
+
+// Maps a scene coordinate to a window coordinate, as seen through the camera.
 vector_t get_window_position(vector_t scene_pos, window_info_t window_info)
+{
+    return get_overlay_position(vec_subtract(scene_pos, window_info.camera.offset), window_info);
+}
+
+
+// Maps a scene coordinate to a window coordinate, ignoring the camera.
+vector_t get_overlay_position(vector_t scene_pos, window_info_t window_info)
 {
     // Scale scene coordinates by the scaling factor
     // and map the center of the scene to the center of the window
@@ -54,9 +54,9 @@ key_handler_t key_handler = NULL;
 // Used to measure how long a key has been held.
 uint32_t key_start_timestamp;
 
-// The value of clock() when time_since_last_tick() was last called.
-// Initially 0.
-clock_t last_clock = 0;
+// The value of the performance counter when time_since_last_tick() was last
+// called. Initially 0.
+uint64_t last_counter = 0;
 
 
 // Converts an SDL key code to a char.
@@ -193,15 +193,14 @@ void sdl_cleanup()
 // Checks whether or not the user has tried to exit the SDL window.
 bool sdl_is_done(void* passer) 
 {
-    SDL_Event *event = malloc(sizeof(SDL_Event));
-    assert(event != NULL);
+    SDL_Event events;
+    SDL_Event *event = &events;
 
     while (SDL_PollEvent(event)) 
     {
         switch (event -> type) 
         {
             case SDL_QUIT:
-                free(event);
                 return true;
             
             case SDL_KEYDOWN:
@@ -224,22 +223,20 @@ bool sdl_is_done(void* passer)
                 break;
         }
     }
-    free(event);
     return false;
 }
 
 // Checks whether or not the user has tried to exit the SDL window.
 bool sdl_is_done_testing(void* passer) 
 {
-    SDL_Event *event = malloc(sizeof(SDL_Event));
-    assert(event != NULL);
+    SDL_Event events;
+    SDL_Event *event = &events;
 
     while (SDL_PollEvent(event)) 
     {
         switch (event -> type) 
         {
             case SDL_QUIT:
-                free(event);
                 return true;
             
             case SDL_KEYDOWN:
@@ -262,7 +259,6 @@ bool sdl_is_done_testing(void* passer)
                 break;
         }
     }
-    free(event);
     return false;
 }
 
@@ -284,7 +280,7 @@ void sdl_render_scene(scene_t *scene)
         for (size_t i = 0; i < list_size(role_list); i ++)
         {
             body_t* body = list_get(role_list, i);
-            sdl_draw_sprite(body, textures, frames, renderer, *window_info);
+            sdl_draw_sprite(body, scene_get_alpha(scene), textures, frames, renderer, *window_info);
         }
     }
    
@@ -303,6 +299,26 @@ void sdl_render()
     // put a line on the screen, but rather updates the backbuffer." 
     SDL_RenderPresent(renderer);
     sdl_clear();
+    // The frame is done, so its scratch memory can be handed out again.
+    frame_reset();
+}
+
+// Scrolls the view to follow a scene position.
+void sdl_camera_follow(vector_t target)
+{
+    camera_follow(target, window_info);
+}
+
+// Stops the view from scrolling past the given scene coordinates.
+void sdl_camera_set_bounds(vector_t min, vector_t max)
+{
+    camera_set_bounds(min, max, window_info);
+}
+
+// Puts the view back at the origin with no bounds.
+void sdl_camera_reset(void)
+{
+    camera_reset(window_info);
 }
 
 // This sets the key handler function.
@@ -312,21 +328,21 @@ void sdl_on_key(key_handler_t handler)
 }
 
 
-// Finds the time elapsed in the runtime of the program since the last time 
-// this function was called.
+// Finds the wall-clock time elapsed since the last time this function was
+// called.
 double time_since_last_tick(void) 
 {
-    // NOTE: From the C library documentation, "clock_t clock(void) returns the number of 
-    // clock ticks elapsed since the program was launched. To get the number of seconds 
-    // used by the CPU, you will need to divide by CLOCKS_PER_SEC."
-    clock_t now = clock();
-    // If last_clock is not zero, i.e. registers as a "true" bolean, then 
+    // NOTE: clock() measures the CPU time used by the process, which drifts
+    // from real time whenever the machine is busy. The performance counter is
+    // monotonic and has the highest resolution SDL can offer.
+    uint64_t now = SDL_GetPerformanceCounter();
+    // If last_counter is not zero, i.e. registers as a "true" bolean, then 
     // define the difference (in seconds); else, define the difference to be 
     // zero.
-    double difference = last_clock
-        ? (double) (now - last_clock) / CLOCKS_PER_SEC
+    double difference = last_counter
+        ? (double) (now - last_counter) / SDL_GetPerformanceFrequency()
         : 0.0; // return 0 the first time this is called
-    last_clock = now;
+    last_counter = now;
 
     return difference;
 }
@@ -1,103 +1,341 @@
 #include "shape.h"
+#include "memory.h"
 #include <math.h>
+#include <string.h>
 
 const int CIRCLE = 0;
 const int POLYGON = 1;
+const int BOX = 2;
 
-// The number of vertices in a circle.
+// The number of vertices used to draw a circle as a polygon.
 const int CIRCLE_vertices = 60;
 
 
-// A struct which stores a CIRCLE or POLYGON shape and the corresponding 
-// vertices. If the shape is of CIRCLE type, it also stores the radius.
+// A struct which stores a CIRCLE, POLYGON or BOX shape and the corresponding 
+// vertices. If the shape is of CIRCLE type, it also stores the radius. A BOX is
+// an axis-aligned rectangle whose min and max corners are its extrema.
+// A CIRCLE is just its centroid and radius; its vertices and normals are only
+// generated if they are asked for.
+//
+// The vertices are stored relative to the centroid and never change. Moving or
+// rotating a shape only changes its centroid and angle, and the vertices in
+// world space are only worked out again when they are asked for.
+//
+// The local vertices, world vertices and normals are packed one after the
+// other in a single array of vector_t, so a shape is two allocations and every
+// loop over its vertices walks contiguous memory.
+//
+// A shape made from a template (see shape_init_instance()) instead points at
+// the template's local vertices and normals, and only owns its array of world
+// vertices. It gets its own copy of the geometry if it is ever rotated.
 typedef struct shape
 {
     int type;
     double radius;
     vector_t centroid;
+    double angle;
+
+    // The number of vertices (and normals).
+    size_t size;
+    // The vertices relative to the centroid, before rotating by angle. Also the
+    // start of the shape's array.
+    vector_t* local;
+    // The vertices in world space, which are out of date while dirty is true.
+    vector_t* vertices;
+    bool dirty;
 
-    list_t* vertices;
     extrema_t extrema;
+    // The axes used for collisions, one per edge. They do not change when the
+    // shape is translated, and are rotated along with it.
+    vector_t* normals;
+
+    // The shared geometry the shape was made from, or NULL if it owns its
+    // geometry.
+    shape_template_t* template;
 
 } shape_t;
 
 
-// Initializes a CIRCLE type shape struct.
-shape_t* shape_init_circle(vector_t position, double radius)
+// Geometry shared by every shape made from it. Never changes once created.
+typedef struct shape_template
 {
-    shape_t* shape = malloc(sizeof(shape_t));
+    int type;
+    double radius;
+    size_t size;
+    // The vertices relative to the centroid, followed by the normals.
+    vector_t* local;
+    vector_t* normals;
+} shape_template_t;
 
-    list_t* vertices = list_init(CIRCLE_vertices, free);
-    
-    // Generates vertices for the circle (used in collision handling).
-    vector_t curr_v = {position.x + radius, position.y};
-    for (size_t i = 0; i < CIRCLE_vertices; i ++)
-    {
-        vector_t* v = malloc(sizeof(vector_t));
-        *v = curr_v;
-        list_add(vertices, v);
-        
-        // vec_rotate now rotates a vector about an inputted position.
-        curr_v = vec_rotate(curr_v, 2 * M_PI / CIRCLE_vertices, position);
 
+// Every template created so far. Templates outlive scenes, so they are always
+// allocated on the heap.
+static list_t* shape_templates = NULL;
+
+
+// Shapes come and go with every fireball and powerup, so freed ones are kept
+// for reuse. Nearly every shape is a box, so the arrays of four vertices are
+// pooled as well.
+pool_t SHAPE_POOL = POOL_INIT("shape", shape_t);
+pool_t QUAD_POOL = POOL_INIT("quad", vector_t[3 * 4]);
+pool_t QUAD_VERTICES_POOL = POOL_INIT("quad vertices", vector_t[4]);
+
+
+// Allocates the array holding the local vertices, world vertices and normals
+// of a shape with the given number of vertices.
+void shape_alloc_vertices(shape_t* shape, size_t size)
+{
+    shape -> size = size;
+    if (size == 4) {shape -> local = pool_alloc(&QUAD_POOL);}
+    else {shape -> local = mem_alloc(3 * size * sizeof(vector_t));}
+    assert(shape -> local != NULL);
+    shape -> vertices = shape -> local + size;
+    shape -> normals = shape -> local + 2 * size;
+    shape -> dirty = true;
+    shape -> template = NULL;
+}
+
+
+// Frees a template and its geometry.
+void shape_template_free(shape_template_t* template)
+{
+    mem_free(template -> local);
+    mem_free(template);
+}
+
+
+// Looks up a template with the given geometry. Circles are told apart by their
+// radius alone.
+shape_template_t* shape_template_find(int type, double radius, vector_t* local, size_t size)
+{
+    if (shape_templates == NULL) {return NULL;}
+    for (size_t i = 0; i < list_size(shape_templates); i ++)
+    {
+        shape_template_t* template = list_get(shape_templates, i);
+        if (template -> type != type || template -> size != size) {continue;}
+        if (type == CIRCLE)
+        {
+            if (template -> radius == radius) {return template;}
+        }
+        else if (memcmp(template -> local, local, size * sizeof(vector_t)) == 0) {return template;}
     }
-    shape -> vertices = vertices;
+    return NULL;
+}
+
+
+// Adds a template with the given local vertices and normals to the registry.
+shape_template_t* shape_template_add(int type, double radius, vector_t* local, vector_t* normals, size_t size)
+{
+    arena_t* previous = mem_use_arena(NULL);
+    if (shape_templates == NULL) {shape_templates = list_init(1, (free_func_t) shape_template_free);}
+
+    shape_template_t* template = mem_alloc(sizeof(shape_template_t));
+    template -> type = type;
+    template -> radius = radius;
+    template -> size = size;
+    template -> local = mem_alloc(2 * size * sizeof(vector_t));
+    template -> normals = template -> local + size;
+    memcpy(template -> local, local, size * sizeof(vector_t));
+    memcpy(template -> normals, normals, size * sizeof(vector_t));
+    list_add(shape_templates, template);
+
+    mem_use_arena(previous);
+    return template;
+}
+
+
+// Gets the template of an axis-aligned box of the given size.
+shape_template_t* shape_template_box(vector_t size)
+{
+    vector_t half = vec_multiply(0.5, size);
+    vector_t local[4] = {{-half.x, -half.y}, {half.x, -half.y}, {half.x, half.y}, {-half.x, half.y}};
+    shape_template_t* template = shape_template_find(BOX, 0, local, 4);
+    if (template != NULL) {return template;}
+
+    vector_t normals[4];
+    polygon_normals(local, 4, normals);
+    return shape_template_add(BOX, vec_magnitude(half), local, normals, 4);
+}
+
+
+// Gets the template of a circle with the given radius, drawn as a polygon.
+shape_template_t* shape_template_circle(double radius)
+{
+    shape_template_t* template = shape_template_find(CIRCLE, radius, NULL, CIRCLE_vertices);
+    if (template != NULL) {return template;}
+
+    vector_t local[CIRCLE_vertices];
+    vector_t normals[CIRCLE_vertices];
+    circle_vertices(VEC_ZERO, radius, CIRCLE_vertices, local);
+    // All normal vectors are radially outwards.
+    for (size_t i = 0; i < CIRCLE_vertices; i ++) {normals[i] = vec_normalize(local[i]);}
+    return shape_template_add(CIRCLE, radius, local, normals, CIRCLE_vertices);
+}
+
+
+// Frees every template. Shapes made from them must be freed first.
+void shape_templates_free(void)
+{
+    if (shape_templates == NULL) {return;}
+    list_free(shape_templates);
+    shape_templates = NULL;
+}
+
+
+// Points a shape at the geometry of a template, and allocates its own array of
+// world vertices.
+void shape_use_template(shape_t* shape, shape_template_t* template)
+{
+    shape -> template = template;
+    shape -> size = template -> size;
+    shape -> local = template -> local;
+    shape -> normals = template -> normals;
+    if (shape -> size == 4) {shape -> vertices = pool_alloc(&QUAD_VERTICES_POOL);}
+    else {shape -> vertices = mem_alloc(shape -> size * sizeof(vector_t));}
+    shape -> dirty = true;
+}
+
+
+// Frees the array of world vertices of a shape made from a template.
+void shape_free_instance_vertices(shape_t* shape)
+{
+    if (shape -> size == 4) {pool_free(&QUAD_VERTICES_POOL, shape -> vertices);}
+    else {mem_free(shape -> vertices);}
+}
+
+
+// Gives a shape made from a template its own copy of the geometry, so it can
+// be changed.
+void shape_detach(shape_t* shape)
+{
+    shape_template_t* template = shape -> template;
+    if (template == NULL) {return;}
+    shape_free_instance_vertices(shape);
+    shape_alloc_vertices(shape, template -> size);
+    memcpy(shape -> local, template -> local, shape -> size * sizeof(vector_t));
+    memcpy(shape -> normals, template -> normals, shape -> size * sizeof(vector_t));
+}
+
+
+// Initializes a shape with the geometry of a template, centred at the given
+// position.
+shape_t* shape_init_instance(shape_template_t* template, vector_t centroid)
+{
+    assert(template != NULL);
+    shape_t* shape = pool_alloc(&SHAPE_POOL);
+    shape -> type = template -> type;
+    shape -> radius = template -> radius;
+    shape -> centroid = centroid;
+    shape -> angle = 0;
+    shape_use_template(shape, template);
+    shape -> extrema = shape_extrema(shape);
+    return shape;
+}
+
+
+// Initializes a CIRCLE type shape struct.
+shape_t* shape_init_circle(vector_t position, double radius)
+{
+    shape_t* shape = pool_alloc(&SHAPE_POOL);
+    assert(shape != NULL);
+
+    shape -> size = 0;
+    shape -> local = NULL;
+    shape -> vertices = NULL;
+    shape -> normals = NULL;
+    shape -> template = NULL;
+    shape -> dirty = true;
     shape -> type = CIRCLE;
     shape -> radius = radius;
     shape -> centroid = position;
+    shape -> angle = 0;
     shape -> extrema = shape_extrema(shape);
 
     return shape;
 }
 
 
-// Initializes a rectangle. The first input is the bottom-left vertex, and the 
-// second input is the top-right vertex.
+// Generates the vertices of a circle, e.g. for drawing it as a polygon.
+void circle_vertices(vector_t position, double radius, size_t size, vector_t* vertices)
+{
+    vector_t curr_v = {position.x + radius, position.y};
+    for (size_t i = 0; i < size; i ++)
+    {
+        vertices[i] = curr_v;
+        // vec_rotate now rotates a vector about an inputted position.
+        curr_v = vec_rotate(curr_v, 2 * M_PI / size, position);
+    }
+}
+
+
+// Generates the vertices and normals of a circle the first time they are
+// needed. Circles that have not been rotated share them with every other
+// circle of the same radius.
+void shape_circle_generate(shape_t* shape)
+{
+    assert(shape -> type == CIRCLE);
+    if (shape -> local != NULL) {return;}
+    // This usually happens while drawing, long after the shape was made, so
+    // the vertices are carved from wherever the shape itself came from. A
+    // shape in a scene's arena then leaves nothing behind when it is dropped.
+    arena_t* previous = mem_use_arena(mem_owner(shape));
+    if (shape -> angle == 0)
+    {
+        shape_use_template(shape, shape_template_circle(shape -> radius));
+        mem_use_arena(previous);
+        return;
+    }
+
+    shape_alloc_vertices(shape, CIRCLE_vertices);
+    circle_vertices(VEC_ZERO, shape -> radius, shape -> size, shape -> local);
+    for (size_t i = 0; i < shape -> size; i ++)
+    {
+        // All normal vectors are radially outwards.
+        vector_t normal = vec_normalize(shape -> local[i]);
+        shape -> normals[i] = vec_rotate(normal, shape -> angle, VEC_ZERO);
+    }
+    mem_use_arena(previous);
+}
+
+
+// Initializes a rectangle as an axis-aligned BOX. The first input is the
+// bottom-left vertex, and the second input is the top-right vertex.
 shape_t* shape_init_rectangle(vector_t v1, vector_t v2)
 {
     // Make sure that the vertices make sense.
     assert(v1.x - v2.x < 0 || v1.y - v2.y < 0);
 
-    list_t* vertices = list_init(4, free);
-    vector_t* vertex1 = malloc(sizeof(vector_t));
-    *vertex1 = v1;
-    list_add(vertices, vertex1);
-    vector_t* vertex2 = malloc(sizeof(vector_t));
-    *vertex2 = (vector_t) {v2.x, v1.y};
-    list_add(vertices, vertex2);
-    vector_t* vertex3 = malloc(sizeof(vector_t));
-    *vertex3 = v2;
-    list_add(vertices, vertex3);
-    vector_t* vertex4 = malloc(sizeof(vector_t));
-    *vertex4 = (vector_t) {v1.x, v2.y};
-    list_add(vertices, vertex4);
-
-    shape_t *shape = shape_init_polygon(vertices);
+    vector_t vertices[4] = {v1, {v2.x, v1.y}, v2, {v1.x, v2.y}};
+    shape_t *shape = shape_init_polygon(vertices, 4);
+    shape -> type = BOX;
     return shape;
 }
 
 
-// Initializes a POLYGON type shape struct.
-shape_t* shape_init_polygon(list_t* vertices)
+// Initializes a POLYGON type shape struct from a copy of the given vertices.
+shape_t* shape_init_polygon(vector_t* vertices, size_t size)
 {
     assert(vertices != NULL);
-    shape_t* shape = malloc(sizeof(shape_t));
-    assert(list_size(vertices) >= 3 &&
-        "Polygon must be initialized with at least three points.");
+    assert(size >= 3 && "Polygon must be initialized with at least three points.");
+    shape_t* shape = pool_alloc(&SHAPE_POOL);
+    assert(shape != NULL);
+
+    shape -> type = POLYGON;
+    shape -> angle = 0;
+    shape_alloc_vertices(shape, size);
+    polygon_normals(vertices, size, shape -> normals);
+    shape -> centroid = polygon_centroid(vertices, size);
 
-    shape -> centroid = polygon_centroid(vertices);
     double max_magnitude = 0;
-    for (size_t i = 0; i < list_size(vertices); i++)
+    for (size_t i = 0; i < size; i++)
     {   
-        vector_t dist_center = vec_subtract(*(vector_t*) list_get(vertices, i), shape -> centroid);
-        double cur_magnitude = vec_magnitude(dist_center);
+        shape -> local[i] = vec_subtract(vertices[i], shape -> centroid);
+        double cur_magnitude = vec_magnitude(shape -> local[i]);
         if(cur_magnitude > max_magnitude)
         {
             max_magnitude = cur_magnitude;
         }
     }
-    shape -> vertices = vertices;
-    shape -> type = POLYGON;
     shape -> radius = max_magnitude;
     shape -> extrema = shape_extrema(shape);
 
@@ -108,8 +346,10 @@ shape_t* shape_init_polygon(list_t* vertices)
 // Frees the memory allocated for a shape object.
 void shape_free(shape_t* shape)
 {
-    list_free(shape -> vertices);
-    free(shape);
+    if (shape -> template != NULL) {shape_free_instance_vertices(shape);}
+    else if (shape -> size == 4) {pool_free(&QUAD_POOL, shape -> local);}
+    else {mem_free(shape -> local);}
+    pool_free(&SHAPE_POOL, shape);
 }
 
 
@@ -117,42 +357,11 @@ void shape_free(shape_t* shape)
 // Accessors and other operations ---------------------------------------------
 
 
-list_t* shape_normals(shape_t* shape)
-{
-    assert(shape -> type == CIRCLE || shape -> type == POLYGON);
-    
-    list_t* normals = list_init(list_size(shape_vertices(shape)), free);
-    list_t* vertices = shape -> vertices;
-
-    if (shape_type(shape) == CIRCLE)
-    {
-        size_t size = list_size(vertices);
-        normals = list_init(size, free);
-        for (size_t i = 0; i < size; i ++)
-        {
-            vector_t v = *(vector_t*) list_get(vertices, i);
-            vector_t* normal = malloc(sizeof(vector_t));
-            
-            // All normal vectors are radially outwards.
-            *normal = vec_normalize(vec_subtract(v, shape_centroid(shape)));
-            list_add(normals, normal);
-        }
-    }
-    else if (shape_type(shape) == POLYGON)
-    {
-        normals = polygon_normals(shape -> vertices);
-    }
-
-    assert(normals != NULL);
-    return normals;
-}
-
-
 // Returns an extrema_t object, which stores the minimum and maximum x and y 
 // values of the shape (for use in collisions).
 extrema_t shape_extrema(shape_t* shape)
 {
-    assert(shape -> type == CIRCLE || shape -> type == POLYGON);
+    assert(shape -> type == CIRCLE || shape -> type == POLYGON || shape -> type == BOX);
     extrema_t extrema = {INFINITY, -1 * INFINITY, INFINITY, -1 * INFINITY};
 
     if (shape_type(shape) == CIRCLE)
@@ -162,14 +371,11 @@ extrema_t shape_extrema(shape_t* shape)
         // extrema_t stores {min_x, max_x, min_y, max_y}
         extrema = (extrema_t) {c.x - r, c.x + r, c.y - r, c.y + r};
     }
-    else if (shape_type(shape) == POLYGON)
+    else if (shape_type(shape) == POLYGON || shape_type(shape) == BOX)
     {
-        list_t* vertices = shape -> vertices;
-        
-        size_t size = list_size(vertices);
-        for (size_t i = 0; i < size; i ++)
+        for (size_t i = 0; i < shape -> size; i ++)
         {
-            vector_t v = *(vector_t*) list_get(vertices, i);
+            vector_t v = shape_vertex(shape, i);
             if (v.x > extrema.max_x) {extrema.max_x = v.x;}
             if (v.x < extrema.min_x) {extrema.min_x = v.x;}
             if (v.y > extrema.max_y) {extrema.max_y = v.y;}
@@ -185,12 +391,25 @@ extrema_t shape_get_extrema(shape_t* shape)
     return shape -> extrema;
 }
 
+// Returns the normals stored in shape
+vector_t* shape_get_normals(shape_t* shape)
+{
+    if (shape -> type == CIRCLE) {shape_circle_generate(shape);}
+    return shape -> normals;
+}
+
 // Returns the area of the inputted shape.
 double shape_area(shape_t* shape)
 {
     if (shape_type(shape) == POLYGON)
     {
-        return polygon_area(shape -> vertices);
+        // The area does not depend on where the shape is.
+        return polygon_area(shape -> local, shape -> size);
+    }
+    else if (shape_type(shape) == BOX)
+    {
+        extrema_t box = shape -> extrema;
+        return (box.max_x - box.min_x) * (box.max_y - box.min_y);
     }
     else if (shape_type(shape) == CIRCLE)
     {
@@ -209,27 +428,31 @@ void shape_translate(shape_t* shape, vector_t translation)
     shape -> extrema = (extrema_t) {shape -> extrema.min_x + translation.x, shape -> extrema.max_x + translation.x, 
     shape -> extrema.min_y + translation.y, shape -> extrema.max_y + translation.y};
 
-    size_t size = list_size(shape -> vertices);
-    for (size_t i = 0; i < size; i ++)
-    {
-        vector_t* v = list_get(shape -> vertices, i);
-        *v = vec_add(*v, translation);
-    }
+    shape -> dirty = true;
 }
 
 
 // Rotates vertices in a shape by a given angle about a given point.
 void shape_rotate(shape_t* shape, double angle, vector_t position)
 {
-    // Update the centroid.
+    // Most bodies never rotate, so skip the work entirely.
+    if (angle == 0) {return;}
+    // A rotated box is no longer axis-aligned.
+    if (shape -> type == BOX) {shape -> type = POLYGON;}
+
+    // Update the centroid and the angle the vertices are rotated by.
     shape -> centroid = vec_rotate(shape -> centroid, angle, position);
+    shape -> angle += angle;
+    shape -> dirty = true;
 
-    size_t size = list_size(shape -> vertices);
-    for (size_t i = 0; i < size; i ++)
+    // The shared geometry must not change, so the shape needs its own.
+    shape_detach(shape);
+    // Rotate the stored normals along with the shape.
+    for (size_t i = 0; i < shape -> size; i ++)
     {
-        vector_t* v = list_get(shape -> vertices, i);
-        *v = vec_rotate(*v, angle, position);
+        shape -> normals[i] = vec_rotate(shape -> normals[i], angle, VEC_ZERO);
     }
+    shape -> extrema = shape_extrema(shape);
 }
 
 
@@ -246,11 +469,49 @@ int shape_type(shape_t* shape)
     return shape -> type;
 }
 
-list_t* shape_vertices(shape_t* shape)
+// Gets the vertex at a given index in world space, without updating the
+// shape's array of vertices.
+vector_t shape_vertex(shape_t* shape, size_t index)
 {
+    assert(index < shape -> size);
+    vector_t v = shape -> local[index];
+    if (shape -> angle != 0) {v = vec_rotate(v, shape -> angle, VEC_ZERO);}
+    return vec_add(v, shape -> centroid);
+}
+
+
+// Gets the vertices of the shape in world space, working them out again if the
+// shape moved since they were last asked for. A circle's vertices are only
+// generated the first time they are needed.
+vector_t* shape_vertices(shape_t* shape)
+{
+    if (shape -> type == CIRCLE) {shape_circle_generate(shape);}
+    if (shape -> dirty)
+    {
+        for (size_t i = 0; i < shape -> size; i ++)
+        {
+            shape -> vertices[i] = shape_vertex(shape, i);
+        }
+        shape -> dirty = false;
+    }
     return shape -> vertices;
 }
 
+
+// Gets the number of vertices of the shape.
+size_t shape_num_vertices(shape_t* shape)
+{
+    if (shape -> type == CIRCLE) {shape_circle_generate(shape);}
+    return shape -> size;
+}
+
+
+// Returns whether the shape holds any vertices yet.
+bool shape_has_vertices(shape_t* shape)
+{
+    return shape -> local != NULL;
+}
+
 // Gets the radius of the shape, if the shape is a CIRCLE.
 double shape_radius(shape_t* shape)
 {
@@ -0,0 +1,318 @@
+#include "spawner.h"
+#include "initialize.h"
+#include "memory.h"
+
+#include <math.h>
+#include <assert.h>
+
+// The level is split into chunks this wide along x.
+const double SPAWNER_CHUNK_WIDTH = 500;
+// Records are added to the scene once a player is this close to them. This is
+// further than the scene keeps bodies awake, so what wakes up is already there.
+const double SPAWNER_LOAD_DISTANCE = 1500;
+// Records are removed from the scene once every player is further than this.
+// It is larger than SPAWNER_LOAD_DISTANCE, so walking back and forth near the
+// edge does not keep adding and removing the same bodies.
+const double SPAWNER_UNLOAD_DISTANCE = 2500;
+// The spawner is run every this many ticks.
+const size_t SPAWNER_PERIOD = 8;
+// The most bodies an add_...() function adds at once (item and tunnel blocks
+// are two bodies).
+#define SPAWN_MAX_BODIES 2
+
+
+// A spawn, along with what it turned into the last time it was added.
+typedef struct spawn_record
+{
+    spawn_t spawn;
+    // The extent of the spawn along x where it was recorded.
+    double min_x;
+    double max_x;
+    // The bodies added for the spawn. Each is NULL once it is removed.
+    body_t *bodies[SPAWN_MAX_BODIES];
+    size_t num_bodies;
+    bool live;
+    // Removed by the game (killed, collected, ...), so never added again.
+    bool consumed;
+    // An item block that was used, along with how it looked.
+    bool spent;
+    sprite_state_t spent_state;
+} spawn_record_t;
+
+
+// Definition of the spawner struct.
+typedef struct spawner
+{
+    scene_t *scene;
+    // Every record of the level. They are carved from the scene's arena.
+    list_t *records;
+    // The records overlapping each chunk. A record spanning several chunks is
+    // in each of them.
+    list_t *chunks;
+    // The records whose bodies are in the scene.
+    list_t *live;
+    size_t tick;
+} spawner_t;
+
+
+// The spawner add_...() functions record into, or NULL.
+static spawner_t *current_spawner = NULL;
+
+
+// Gets the chunk an x coordinate falls in. Everything left of the level is in
+// the first chunk.
+size_t spawner_chunk(double x)
+{
+    if (x < 0) {return 0;}
+    return (size_t) (x / SPAWNER_CHUNK_WIDTH);
+}
+
+
+// Gets the role list the bodies of a spawn are added to.
+role_t spawner_role(spawn_kind_t kind)
+{
+    if (kind == SPAWN_ENEMY) {return ENEMY;}
+    if (kind == SPAWN_TOKEN) {return TOKEN;}
+    if (kind == SPAWN_POWERUP) {return POWERUP;}
+    return PLATFORM;
+}
+
+
+// Runs the spawner every SPAWNER_PERIOD ticks. A force creator with no bodies,
+// so it is never removed from the scene.
+void spawner_tick(interaction_t *interaction)
+{
+    spawner_t *spawner = interaction_get_aux(interaction);
+    spawner -> tick ++;
+    if (spawner -> tick % SPAWNER_PERIOD == 0) {spawner_update(spawner);}
+}
+
+
+// Notices bodies the game removes, so they are not spawned again.
+void spawner_forget(spawner_t *spawner, body_t *body)
+{
+    size_t num_live = list_size(spawner -> live);
+    for (size_t i = 0; i < num_live; i ++)
+    {
+        spawn_record_t *record = list_get(spawner -> live, i);
+        bool any_left = false;
+        bool found = false;
+        for (size_t k = 0; k < record -> num_bodies; k ++)
+        {
+            if (record -> bodies[k] == body) {record -> bodies[k] = NULL; found = true;}
+            else if (record -> bodies[k] != NULL) {any_left = true;}
+        }
+        if (!found) {continue;}
+
+        record -> consumed = true;
+        if (!any_left)
+        {
+            record -> live = false;
+            list_swap_remove(spawner -> live, i);
+        }
+        return;
+    }
+}
+
+
+// Allocates a spawner for a scene, and has the scene run it.
+spawner_t *spawner_init(scene_t *scene)
+{
+    arena_t *previous = mem_use_arena(scene_get_arena(scene));
+    spawner_t *spawner = mem_alloc(sizeof(spawner_t));
+    assert(spawner != NULL);
+    spawner -> scene = scene;
+    spawner -> records = list_init(16, mem_free);
+    spawner -> chunks = list_init(16, (free_func_t) list_free);
+    spawner -> live = list_init(16, NULL);
+    spawner -> tick = 0;
+
+    scene_add_bodies_force_creator(scene, spawner_tick, spawner, list_init(1, NULL), NULL);
+    scene_set_remove_handler(scene, (remove_handler_t) spawner_forget, spawner);
+    mem_use_arena(previous);
+    return spawner;
+}
+
+
+// Sets the spawner add_...() functions record into.
+spawner_t *spawner_use(spawner_t *spawner)
+{
+    spawner_t *previous = current_spawner;
+    current_spawner = spawner;
+    return previous;
+}
+
+
+// Records a spawn into the current spawner, and into every chunk it overlaps.
+bool spawner_record(spawn_t spawn)
+{
+    spawner_t *spawner = current_spawner;
+    if (spawner == NULL) {return false;}
+    assert(spawn.info == NULL || mem_owner(spawn.info) == scene_get_arena(spawner -> scene));
+
+    arena_t *previous = mem_use_arena(scene_get_arena(spawner -> scene));
+    spawn_record_t *record = mem_calloc(1, sizeof(spawn_record_t));
+    record -> spawn = spawn;
+    if (spawn.kind == SPAWN_PLATFORM)
+    {
+        record -> min_x = spawn.p1.x - spawn.p2.x / 2;
+        record -> max_x = spawn.p1.x + spawn.p2.x / 2;
+    }
+    else if (spawn.kind == SPAWN_PLATFORM_CORNERS)
+    {
+        record -> min_x = fmin(spawn.p1.x, spawn.p2.x);
+        record -> max_x = fmax(spawn.p1.x, spawn.p2.x);
+    }
+    else
+    {
+        record -> min_x = spawn.p1.x;
+        record -> max_x = spawn.p1.x;
+    }
+    list_add(spawner -> records, record);
+
+    size_t last = spawner_chunk(record -> max_x);
+    while (list_size(spawner -> chunks) <= last)
+    {
+        list_add(spawner -> chunks, list_init(16, NULL));
+    }
+    for (size_t chunk = spawner_chunk(record -> min_x); chunk <= last; chunk ++)
+    {
+        list_add(list_get(spawner -> chunks, chunk), record);
+    }
+    mem_use_arena(previous);
+    return true;
+}
+
+
+// Returns whether some player is within the given distance of an extent
+// along x.
+bool spawner_near(list_t *players, double min_x, double max_x, double distance)
+{
+    size_t num_players = list_size(players);
+    for (size_t i = 0; i < num_players; i ++)
+    {
+        double x = body_get_centroid(list_get(players, i)).x;
+        if (max_x >= x - distance && min_x <= x + distance) {return true;}
+    }
+    return false;
+}
+
+
+// Adds the bodies of a record to the scene, and wires them to the rest.
+void spawner_spawn(spawner_t *spawner, spawn_record_t *record)
+{
+    scene_t *scene = spawner -> scene;
+    spawn_t spawn = record -> spawn;
+    // A used item block comes back as a plain block that looks used.
+    if (record -> spent)
+    {
+        spawn.subrole = REGULAR_BLOCK;
+        spawn.info = NULL;
+    }
+
+    list_t *bodies = scene_get_list(scene, spawner_role(spawn.kind));
+    size_t first = list_size(bodies);
+    if (spawn.kind == SPAWN_PLATFORM) {add_platform(scene, spawn.p1, spawn.p2, spawn.subrole, spawn.info);}
+    if (spawn.kind == SPAWN_PLATFORM_CORNERS) {add_platform_corners(scene, spawn.p1, spawn.p2, spawn.subrole, spawn.info);}
+    if (spawn.kind == SPAWN_ENEMY) {add_enemy(scene, spawn.p1, spawn.subrole);}
+    if (spawn.kind == SPAWN_TOKEN) {add_token(scene, spawn.p1);}
+    if (spawn.kind == SPAWN_POWERUP) {add_powerup(scene, spawn.p1, spawn.subrole);}
+
+    // The new bodies are the ones appended to their role's list.
+    record -> num_bodies = 0;
+    for (size_t i = first; i < list_size(bodies); i ++)
+    {
+        assert(record -> num_bodies < SPAWN_MAX_BODIES);
+        body_t *body = list_get(bodies, i);
+        if (record -> spent) {sprite_set_state(body_get_info(body), record -> spent_state);}
+        record -> bodies[record -> num_bodies] = body;
+        record -> num_bodies ++;
+        initialize_body(scene, body);
+    }
+    record -> live = true;
+    list_add(spawner -> live, record);
+}
+
+
+// Removes the bodies of a record from the scene, remembering what the game did
+// to them.
+void spawner_despawn(spawn_record_t *record)
+{
+    sprite_state_t unused = state_select(PLATFORM, ITEM_BLOCK);
+    for (size_t k = 0; k < record -> num_bodies; k ++)
+    {
+        body_t *body = record -> bodies[k];
+        if (body == NULL) {continue;}
+        // Removed by the game in this very tick.
+        if (body_is_removed(body)) {record -> consumed = true;}
+
+        sprite_t *sprite = body_get_info(body);
+        if (sprite_subrole(sprite) == ITEM_BLOCK && !sprite_state_equal(sprite, unused))
+        {
+            record -> spent = true;
+            record -> spent_state = sprite_get_state(sprite);
+        }
+        body_remove(body);
+        record -> bodies[k] = NULL;
+    }
+    record -> live = false;
+}
+
+
+// Adds to the scene everything recorded near a player, and removes what is far
+// from all of them.
+void spawner_update(spawner_t *spawner)
+{
+    scene_t *scene = spawner -> scene;
+    list_t *players = scene_get_list(scene, PLAYER);
+    if (list_size(players) == 0) {return;}
+    arena_t *previous_arena = mem_use_arena(scene_get_arena(scene));
+    // The add_...() functions have to add to the scene now, not record.
+    spawner_t *previous = spawner_use(NULL);
+
+    for (size_t i = list_size(spawner -> live); i > 0; i --)
+    {
+        spawn_record_t *record = list_get(spawner -> live, i - 1);
+        double min_x = record -> min_x;
+        double max_x = record -> max_x;
+        // Whatever walks around is judged by where it is now.
+        if (spawner_role(record -> spawn.kind) != PLATFORM && record -> bodies[0] != NULL)
+        {
+            min_x = max_x = body_get_centroid(record -> bodies[0]).x;
+        }
+        if (spawner_near(players, min_x, max_x, SPAWNER_UNLOAD_DISTANCE)) {continue;}
+        spawner_despawn(record);
+        list_swap_remove(spawner -> live, i - 1);
+    }
+
+    size_t num_chunks = list_size(spawner -> chunks);
+    size_t num_players = list_size(players);
+    for (size_t j = 0; j < num_players && num_chunks > 0; j ++)
+    {
+        double x = body_get_centroid(list_get(players, j)).x;
+        size_t first = spawner_chunk(x - SPAWNER_LOAD_DISTANCE);
+        size_t last = spawner_chunk(x + SPAWNER_LOAD_DISTANCE);
+        if (last >= num_chunks) {last = num_chunks - 1;}
+        for (size_t chunk = first; chunk <= last; chunk ++)
+        {
+            list_t *records = list_get(spawner -> chunks, chunk);
+            for (size_t i = 0; i < list_size(records); i ++)
+            {
+                spawn_record_t *record = list_get(records, i);
+                if (record -> live || record -> consumed) {continue;}
+                if (!spawner_near(players, record -> min_x, record -> max_x, SPAWNER_LOAD_DISTANCE)) {continue;}
+                spawner_spawn(spawner, record);
+            }
+        }
+    }
+
+    spawner_use(previous);
+    mem_use_arena(previous_arena);
+}
+
+
+// Gets the number of records currently added to the scene.
+size_t spawner_num_live(spawner_t *spawner)
+{
+    return list_size(spawner -> live);
+}
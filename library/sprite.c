@@ -1,4 +1,5 @@
 #include "sprite.h"
+#include "memory.h"
 #include "sdl_wrapper.h"
 #include <SDL2/SDL_mixer.h>
 
@@ -85,8 +86,6 @@ typedef struct sprite
     size_t tokens;
     size_t kills;
 
-    // If contact something to left, right, above, below
-    contact_t contact;
     // Allows us to prevent the player from moving the sprite if we need to.
     double immobilized;
 
@@ -98,6 +97,11 @@ typedef struct sprite
 
 } sprite_t;
 
+
+// Freed sprites are kept for reuse.
+pool_t SPRITE_POOL = POOL_INIT("sprite", sprite_t);
+
+
 // Returns whether or not two sprite states are equal.
 bool sprite_state_equal(sprite_t* s1, sprite_state_t s2)
 {
@@ -131,7 +135,7 @@ sprite_state_t state_select(role_t role, subrole_t subrole)
 // Initialize a generalized sprite struct.
 sprite_t *sprite_init(role_t role, subrole_t subrole, size_t health, bool animated)
 {
-    sprite_t *sprite = malloc(sizeof(sprite_t));
+    sprite_t *sprite = pool_alloc(&SPRITE_POOL);
 
     sprite->role = role;
     sprite->subrole = subrole;
@@ -139,13 +143,12 @@ sprite_t *sprite_init(role_t role, subrole_t subrole, size_t health, bool animat
     sprite->animated = animated;
     
     sprite->info = NULL;
-    sprite->info_freer = free;
+    sprite->info_freer = mem_free;
 
     sprite->health = health;
     sprite->tokens = 0;
     sprite->kills = 0;
 
-    sprite->contact = (contact_t){false, false, false, false};
     sprite->immobilized = 0;
 
     sprite->time_since_last_frame = 0;
@@ -179,7 +182,7 @@ void sprite_free(sprite_t* sprite)
     {
         (sprite -> info_freer)(sprite -> info);
     }
-    free(sprite);
+    pool_free(&SPRITE_POOL, sprite);
 }
 
 // Handles the sprite animation. We can add to this later for more
@@ -251,12 +254,6 @@ vector_t sprite_current_frame(sprite_t *sprite)
     return sprite->current_frame;
 }
 
-// Checks to see what the sprite is in contact with.
-contact_t sprite_contact(sprite_t *sprite)
-{
-    return sprite->contact;
-}
-
 // Gets the sprite's role.
 role_t sprite_role(sprite_t *player)
 {
@@ -269,12 +266,6 @@ subrole_t sprite_subrole(sprite_t *player)
     return player->subrole;
 }
 
-// Change the value of the contact fields
-void sprite_set_contact(sprite_t *player, contact_t contact)
-{
-    player->contact = contact;
-}
-
 // Applies a powerup to the player sprite and changes the animation accordingly
 void sprite_activate_powerup(sprite_t *player, subrole_t powerup)
 {
@@ -346,7 +337,7 @@ void sprite_set_info(sprite_t* sprite, void* info)
 {
     void* old_info = sprite -> info;
     sprite -> info = info;
-    if(old_info != NULL) {free(old_info);}
+    if(old_info != NULL && sprite -> info_freer != NULL) {sprite -> info_freer(old_info);}
 }
 
 // Sets current frame....this is used to change graphics back to normal mode
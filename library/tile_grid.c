@@ -0,0 +1,252 @@
+#include "tile_grid.h"
+#include "memory.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+// The cell map is resized once it is more than half full.
+const size_t TILE_GRID_RESIZE_FACTOR = 2;
+const size_t TILE_GRID_INITIAL_CELLS = 64;
+
+
+// A body filed in the grid, along with the box and cells it covers. Every cell
+// of the body points to the same tile.
+typedef struct tile
+{
+    body_t *body;
+    extrema_t box;
+    long min_x;
+    long min_y;
+    long max_x;
+    long max_y;
+} tile_t;
+
+
+// Tiles come and go as platforms are streamed in and out.
+pool_t TILE_POOL = POOL_INIT("tile", tile_t);
+
+
+// A single slot of the cell map. A slot is empty if its tiles are NULL. Cells
+// are never taken out of the map, only emptied.
+typedef struct cell
+{
+    long x;
+    long y;
+    list_t *tiles;
+} cell_t;
+
+
+// Definition of the tile grid struct. The cells are kept in a hash map from
+// their coordinates, using open addressing with linear probing, and the
+// capacity is always a power of two.
+typedef struct tile_grid
+{
+    double cell_size;
+    cell_t *cells;
+    size_t num_cells;
+    size_t capacity;
+    size_t size;
+} tile_grid_t;
+
+
+// Gets the cell a coordinate falls in along one axis.
+long tile_grid_cell(tile_grid_t *grid, double coordinate)
+{
+    return (long) floor(coordinate / grid -> cell_size);
+}
+
+
+// Mixes the coordinates of a cell into a slot index.
+size_t tile_grid_hash(long x, long y, size_t capacity)
+{
+    uint64_t h = (uint64_t) x * 0x9E3779B97F4A7C15ULL;
+    h ^= (uint64_t) y + 0x7F4A7C159E3779B9ULL + (h << 6) + (h >> 2);
+    h ^= h >> 31;
+    return (size_t) (h & (capacity - 1));
+}
+
+
+// Finds the slot holding a cell, or the empty slot where it would go.
+size_t tile_grid_find(tile_grid_t *grid, long x, long y)
+{
+    size_t mask = grid -> capacity - 1;
+    size_t i = tile_grid_hash(x, y, grid -> capacity);
+    while (grid -> cells[i].tiles != NULL)
+    {
+        if (grid -> cells[i].x == x && grid -> cells[i].y == y) {return i;}
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+
+// Allocates memory for an empty tile grid.
+tile_grid_t *tile_grid_init(double cell_size)
+{
+    assert(cell_size > 0);
+    tile_grid_t *grid = mem_alloc(sizeof(tile_grid_t));
+    assert(grid != NULL);
+    grid -> cell_size = cell_size;
+    grid -> num_cells = 0;
+    grid -> capacity = TILE_GRID_INITIAL_CELLS;
+    grid -> size = 0;
+    grid -> cells = mem_calloc(grid -> capacity, sizeof(cell_t));
+    assert(grid -> cells != NULL);
+    return grid;
+}
+
+
+// Releases the memory allocated for a tile grid, along with its tiles.
+void tile_grid_free(tile_grid_t *grid)
+{
+    // Each tile is collected from the first cell of its body, and only freed
+    // once no cell is left to look at it.
+    list_t *tiles = list_init(grid -> size + 1, NULL);
+    for (size_t i = 0; i < grid -> capacity; i ++)
+    {
+        cell_t cell = grid -> cells[i];
+        if (cell.tiles == NULL) {continue;}
+        for (size_t j = 0; j < list_size(cell.tiles); j ++)
+        {
+            tile_t *tile = list_get(cell.tiles, j);
+            if (tile -> min_x == cell.x && tile -> min_y == cell.y) {list_add(tiles, tile);}
+        }
+        list_free(cell.tiles);
+    }
+    for (size_t i = 0; i < list_size(tiles); i ++) {pool_free(&TILE_POOL, list_get(tiles, i));}
+    list_free(tiles);
+    mem_free(grid -> cells);
+    mem_free(grid);
+}
+
+
+// Doubles the capacity of the cell map and re-inserts every cell.
+void tile_grid_resize(tile_grid_t *grid)
+{
+    cell_t *old = grid -> cells;
+    size_t old_capacity = grid -> capacity;
+
+    grid -> capacity *= TILE_GRID_RESIZE_FACTOR;
+    grid -> cells = mem_alloc_from(mem_owner(grid), grid -> capacity * sizeof(cell_t));
+    assert(grid -> cells != NULL);
+    memset(grid -> cells, 0, grid -> capacity * sizeof(cell_t));
+
+    for (size_t i = 0; i < old_capacity; i ++)
+    {
+        if (old[i].tiles == NULL) {continue;}
+        grid -> cells[tile_grid_find(grid, old[i].x, old[i].y)] = old[i];
+    }
+    mem_free(old);
+}
+
+
+// Gets the tiles of a cell, adding the cell if it is not in the map yet.
+list_t *tile_grid_get_cell(tile_grid_t *grid, long x, long y)
+{
+    size_t i = tile_grid_find(grid, x, y);
+    if (grid -> cells[i].tiles != NULL) {return grid -> cells[i].tiles;}
+
+    if (TILE_GRID_RESIZE_FACTOR * (grid -> num_cells + 1) > grid -> capacity)
+    {
+        tile_grid_resize(grid);
+        i = tile_grid_find(grid, x, y);
+    }
+    grid -> cells[i] = (cell_t) {x, y, list_init(4, NULL)};
+    grid -> num_cells ++;
+    return grid -> cells[i].tiles;
+}
+
+
+// Files a static body under the cells its bounding box covers.
+void tile_grid_add(tile_grid_t *grid, body_t *body)
+{
+    assert(body_is_static(body));
+    tile_t *tile = pool_alloc(&TILE_POOL);
+    extrema_t box = body_get_extrema(body);
+    *tile = (tile_t) {body, box, tile_grid_cell(grid, box.min_x), tile_grid_cell(grid, box.min_y),
+        tile_grid_cell(grid, box.max_x), tile_grid_cell(grid, box.max_y)};
+
+    for (long x = tile -> min_x; x <= tile -> max_x; x ++)
+    {
+        for (long y = tile -> min_y; y <= tile -> max_y; y ++)
+        {
+            list_add(tile_grid_get_cell(grid, x, y), tile);
+        }
+    }
+    grid -> size ++;
+}
+
+
+// Takes a body out of every cell it was filed under. Static bodies never
+// move, so those are the cells its box covers now.
+void tile_grid_remove(tile_grid_t *grid, body_t *body)
+{
+    extrema_t box = body_get_extrema(body);
+    long min_x = tile_grid_cell(grid, box.min_x);
+    long min_y = tile_grid_cell(grid, box.min_y);
+    long max_x = tile_grid_cell(grid, box.max_x);
+    long max_y = tile_grid_cell(grid, box.max_y);
+
+    tile_t *removed = NULL;
+    for (long x = min_x; x <= max_x; x ++)
+    {
+        for (long y = min_y; y <= max_y; y ++)
+        {
+            cell_t *cell = &grid -> cells[tile_grid_find(grid, x, y)];
+            if (cell -> tiles == NULL) {continue;}
+            for (size_t i = 0; i < list_size(cell -> tiles); i ++)
+            {
+                tile_t *tile = list_get(cell -> tiles, i);
+                if (tile -> body != body) {continue;}
+                removed = list_swap_remove(cell -> tiles, i);
+                break;
+            }
+        }
+    }
+    if (removed == NULL) {return;}
+    pool_free(&TILE_POOL, removed);
+    grid -> size --;
+}
+
+
+// Replaces the contents of found with every body whose box overlaps the given
+// box. A body covering several of the cells looked at is only listed from the
+// first of them along each axis.
+void tile_grid_query(tile_grid_t *grid, extrema_t box, list_t *found)
+{
+    while (list_size(found) > 0) {list_swap_remove(found, list_size(found) - 1);}
+
+    long min_x = tile_grid_cell(grid, box.min_x);
+    long min_y = tile_grid_cell(grid, box.min_y);
+    long max_x = tile_grid_cell(grid, box.max_x);
+    long max_y = tile_grid_cell(grid, box.max_y);
+    for (long x = min_x; x <= max_x; x ++)
+    {
+        for (long y = min_y; y <= max_y; y ++)
+        {
+            list_t *tiles = grid -> cells[tile_grid_find(grid, x, y)].tiles;
+            if (tiles == NULL) {continue;}
+            size_t num_tiles = list_size(tiles);
+            for (size_t i = 0; i < num_tiles; i ++)
+            {
+                tile_t *tile = list_get(tiles, i);
+                if (x != ((tile -> min_x > min_x) ? tile -> min_x : min_x)) {continue;}
+                if (y != ((tile -> min_y > min_y) ? tile -> min_y : min_y)) {continue;}
+                extrema_t other = tile -> box;
+                if (other.min_x > box.max_x || box.min_x > other.max_x) {continue;}
+                if (other.min_y > box.max_y || box.min_y > other.max_y) {continue;}
+                list_add(found, tile -> body);
+            }
+        }
+    }
+}
+
+
+// Gets the number of bodies in the grid.
+size_t tile_grid_size(tile_grid_t *grid)
+{
+    return grid -> size;
+}
@@ -16,46 +16,16 @@ double MASS = 1;
 
 shape_t *make_shape() 
 {
-    list_t* vertices = list_init(4, free);
-
-    vector_t *v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, -1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, -1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, +1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, +1};
-    list_add(vertices, v);
-    
-    shape_t *shape = shape_init_polygon(vertices);
+    vector_t vertices[] = {{-1, -1}, {+1, -1}, {+1, +1}, {-1, +1}};
+    shape_t *shape = shape_init_polygon(vertices, 4);
     return shape;
 }
 
 
 shape_t *make_triangle() 
 {
-    list_t* vertices = list_init(4, free);
-
-    vector_t *v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, -1};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, -1};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {0, +1};
-    list_add(vertices, v);
-    
-    shape_t *shape = shape_init_polygon(vertices);
+    vector_t vertices[] = {{-1, -1}, {+1, -1}, {0, +1}};
+    shape_t *shape = shape_init_polygon(vertices, 3);
     return shape;
 }
 
@@ -67,22 +37,17 @@ shape_t *make_circle()
     double circle_radius = 1;
     double angle = 0;
 
-    list_t* vertices = list_init(CIRCLE_NPOINTS, free);
+    vector_t vertices[CIRCLE_NPOINTS];
 
     for (size_t i = 0; i < CIRCLE_NPOINTS; i ++)
     {
-      vector_t* new_point = malloc(sizeof(vector_t));
-      assert(new_point != NULL);
-
-      new_point -> x = circle_radius;
-      new_point -> y = 0;
-      *new_point = vec_rotate(*new_point, angle, VEC_ZERO);
-      list_add(vertices, new_point);
+      vector_t new_point = {circle_radius, 0};
+      vertices[i] = vec_rotate(new_point, angle, VEC_ZERO);
       // Changes the angle of rotation by one increment.
       angle += (2 * M_PI / (CIRCLE_NPOINTS));
     }
 
-    shape_t* shape = shape_init_polygon(vertices);
+    shape_t* shape = shape_init_polygon(vertices, CIRCLE_NPOINTS);
     return shape;
 }
 
@@ -344,6 +309,116 @@ void test_collision_circle_triangle()
     body_free(body2);
 }
 
+void test_collision_box()
+{
+    body_t *body1 = body_init(shape_init_rectangle((vector_t) {-1, -1}, (vector_t) {1, 1}), MASS, COLOR);
+    body_t *body2 = body_init(shape_init_rectangle((vector_t) {-1, -1}, (vector_t) {1, 1}), MASS, COLOR);
+    assert(shape_type(body_shape(body1)) == BOX);
+
+    // Overlapping more along x than y, so they are pushed apart along y.
+    body_translate(body1, (vector_t) {0.5, 1.5});
+    collision_info_t info = find_collision(body1, body2);
+    assert(info.collided == true);
+    assert(vec_isclose(info.axis, (vector_t) {0, -1}));
+    assert(isclose(info.overlap, 0.5));
+    assert(vec_isclose(info.overlap_v, (vector_t) {1.5, 0.5}));
+
+    // Overlapping more along y than x, so they are pushed apart along x.
+    body_translate(body1, (vector_t) {1, -1.25});
+    info = find_collision(body1, body2);
+    assert(info.collided == true);
+    assert(vec_isclose(info.axis, (vector_t) {-1, 0}));
+    assert(isclose(info.overlap, 0.5));
+
+    body_translate(body1, (vector_t) {1, 0});
+    assert(find_collision(body1, body2).collided == false);
+
+    // A rotated box is collided as a general polygon.
+    body_translate(body1, (vector_t) {-1.5, 0});
+    body_set_rotation(body1, M_PI / 4);
+    assert(shape_type(body_shape(body1)) == POLYGON);
+    assert(find_collision(body1, body2).collided == true);
+
+    body_free(body1);
+    body_free(body2);
+}
+
+void test_collision_circle()
+{
+    body_t *body1 = body_init(shape_init_circle(VEC_ZERO, 1), MASS, COLOR);
+    body_t *body2 = body_init(shape_init_circle((vector_t) {1.5, 0}, 1), MASS, COLOR);
+    body_t *box = body_init(shape_init_rectangle((vector_t) {-1, -1}, (vector_t) {1, 1}), MASS, COLOR);
+    body_t *triangle = body_init(make_triangle(), MASS, COLOR);
+
+    // Circle against circle.
+    collision_info_t info = find_collision(body1, body2);
+    assert(info.collided == true);
+    assert(vec_isclose(info.axis, (vector_t) {1, 0}));
+    assert(isclose(info.overlap, 0.5));
+    body_translate(body2, (vector_t) {0.6, 0});
+    assert(find_collision(body1, body2).collided == false);
+
+    // Circle against the side and the corner of a box.
+    body_translate(body1, (vector_t) {0, 1.5});
+    info = find_collision(body1, box);
+    assert(info.collided == true);
+    assert(vec_isclose(info.axis, (vector_t) {0, -1}));
+    assert(isclose(info.overlap, 0.5));
+    info = find_collision(box, body1);
+    assert(vec_isclose(info.axis, (vector_t) {0, 1}));
+    body_translate(body1, (vector_t) {1.5, 0});
+    info = find_collision(body1, box);
+    assert(info.collided == true);
+    assert(vec_isclose(info.axis, vec_normalize((vector_t) {-1, -1})));
+    assert(isclose(info.overlap, 1 - sqrt(0.5)));
+    body_translate(body1, (vector_t) {0.5, 0.5});
+    assert(find_collision(body1, box).collided == false);
+
+    // Circle against a polygon.
+    body_set_centroid(body1, (vector_t) {0, 1.9});
+    assert(find_collision(body1, triangle).collided == true);
+    assert(vec_isclose(find_collision(body1, triangle).axis, (vector_t) {0, -1}));
+    body_set_centroid(body1, (vector_t) {0, 2.1});
+    assert(find_collision(body1, triangle).collided == false);
+    body_set_centroid(body1, (vector_t) {1.5, 1});
+    assert(find_collision(triangle, body1).collided == false);
+
+    // No vertices are needed to collide circles.
+    assert(shape_type(body_shape(body1)) == CIRCLE);
+    assert(!shape_has_vertices(body_shape(body1)));
+    assert(!shape_has_vertices(body_shape(body2)));
+
+    body_free(body1);
+    body_free(body2);
+    body_free(box);
+    body_free(triangle);
+}
+
+void test_time_of_impact()
+{
+    extrema_t box = {-1, 1, -1, 1};
+    extrema_t platform = {-10, 10, -5, -4};
+    vector_t axis;
+
+    // Falling far enough in one step to pass through the platform.
+    double t = find_time_of_impact(box, (vector_t) {0, -10}, platform, &axis);
+    assert(isclose(t, 0.3));
+    assert(vec_isclose(axis, (vector_t) {0, -1}));
+
+    // Moving diagonally into the side of a wall.
+    extrema_t wall = {3, 4, -10, 10};
+    t = find_time_of_impact(box, (vector_t) {4, 4}, wall, &axis);
+    assert(isclose(t, 0.5));
+    assert(vec_isclose(axis, (vector_t) {1, 0}));
+
+    // Stopping short, moving away, and passing beside it.
+    assert(find_time_of_impact(box, (vector_t) {0, -2}, platform, &axis) == -1);
+    assert(find_time_of_impact(box, (vector_t) {0, 10}, platform, &axis) == -1);
+    assert(find_time_of_impact(box, (vector_t) {20, -10}, (extrema_t) {-10, -5, -5, -4}, &axis) == -1);
+    // Already overlapping at the start.
+    assert(find_time_of_impact(box, (vector_t) {0, -10}, (extrema_t) {-2, 2, 0, 5}, &axis) == -1);
+}
+
 int main(int argc, char *argv[]) {
     // Run all tests if there are no command-line arguments
     bool all_tests = argc == 1;
@@ -358,6 +433,9 @@ int main(int argc, char *argv[]) {
     DO_TEST(test_collision_triangle_sq)
     DO_TEST(test_collision_circle_sq)
     DO_TEST(test_collision_circle_triangle)
+    DO_TEST(test_collision_box)
+    DO_TEST(test_collision_circle)
+    DO_TEST(test_time_of_impact)
 
     puts("collision_tests PASS");
 }
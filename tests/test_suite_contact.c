@@ -0,0 +1,97 @@
+#include "body.h"
+#include "test_util.h"
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+// A 2 by 2 box centered on the origin.
+body_t *make_box() {
+    shape_t *shape = shape_init_rectangle((vector_t) {-1, -1}, (vector_t) {1, 1});
+    return body_init(shape, 1, (rgb_color_t) {0, 0, 0});
+}
+
+void test_resolve_same_direction() {
+    body_t *body = make_box();
+    contact_t below = {false, false, false, true};
+    // Resting on two blocks side by side, sunk into both by the same amount.
+    body_add_contact(body, (vector_t) {0, 1}, 0.5, below);
+    body_add_contact(body, (vector_t) {0, 1}, 0.5, below);
+    body_resolve_contacts(body);
+    assert(vec_isclose(body_get_centroid(body), (vector_t) {0, 0.5}));
+
+    // The deeper of two contacts pushing the same way wins.
+    body_add_contact(body, (vector_t) {0, 1}, 0.25, below);
+    body_add_contact(body, (vector_t) {0, 1}, 1, below);
+    body_resolve_contacts(body);
+    assert(vec_isclose(body_get_centroid(body), (vector_t) {0, 1.5}));
+    body_free(body);
+}
+
+void test_resolve_opposing() {
+    body_t *body = make_box();
+    // Squeezed between two walls, which can never both be satisfied.
+    body_add_contact(body, (vector_t) {1, 0}, 1, (contact_t) {true, false, false, false});
+    body_add_contact(body, (vector_t) {-1, 0}, 3, (contact_t) {false, true, false, false});
+    body_resolve_contacts(body);
+    vector_t centroid = body_get_centroid(body);
+    // The passes are bounded, and never push the body further than the
+    // deepest contact.
+    assert(fabs(centroid.x) <= 3 + 1e-9);
+    assert(centroid.y == 0);
+    contact_t contact = body_get_contact(body);
+    assert(contact.left && contact.right);
+    body_free(body);
+}
+
+void test_resolve_full_contacts() {
+    body_t *body = make_box();
+    contact_t below = {false, false, false, true};
+    body_add_contact(body, (vector_t) {1, 0}, 0.25, (contact_t) {true, false, false, false});
+    for (size_t i = 1; i < BODY_MAX_CONTACTS; i ++) {
+        body_add_contact(body, (vector_t) {0, 1}, 1, below);
+    }
+    // Shallower than every contact kept, so it is dropped.
+    body_add_contact(body, (vector_t) {0, -1}, 0.125, below);
+    // Deeper than the shallowest, which it replaces.
+    body_add_contact(body, (vector_t) {-1, 0}, 2, below);
+    body_resolve_contacts(body);
+    assert(vec_isclose(body_get_centroid(body), (vector_t) {-2, 1}));
+    body_free(body);
+}
+
+void test_resolve_clears_sides() {
+    body_t *body = make_box();
+    body_add_contact(body, (vector_t) {0, 1}, 0.5, (contact_t) {false, false, false, true});
+    body_add_contact(body, (vector_t) {-1, 0}, 0, (contact_t) {false, true, false, false});
+    contact_t contact = body_get_contact(body);
+    assert(!contact.left && !contact.right && !contact.above && !contact.below);
+
+    body_resolve_contacts(body);
+    contact = body_get_contact(body);
+    assert(!contact.left && contact.right && !contact.above && contact.below);
+
+    // Nothing was recorded since, so nothing is touching anymore and the body
+    // stays put.
+    body_resolve_contacts(body);
+    contact = body_get_contact(body);
+    assert(!contact.left && !contact.right && !contact.above && !contact.below);
+    assert(vec_isclose(body_get_centroid(body), (vector_t) {0, 0.5}));
+    body_free(body);
+}
+
+int main(int argc, char *argv[]) {
+    // Run all tests if there are no command-line arguments
+    bool all_tests = argc == 1;
+    // Read test name from file
+    char testname[100];
+    if (!all_tests) {
+        read_testname(argv[1], testname, sizeof(testname));
+    }
+
+    DO_TEST(test_resolve_same_direction)
+    DO_TEST(test_resolve_opposing)
+    DO_TEST(test_resolve_full_contacts)
+    DO_TEST(test_resolve_clears_sides)
+
+    puts("contact_test PASS");
+}
@@ -7,25 +7,8 @@
 
 shape_t *make_shape() 
 {
-    list_t* vertices = list_init(4, free);
-
-    vector_t *v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, -1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, -1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, +1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, +1};
-    list_add(vertices, v);
-    
-    shape_t* shape = shape_init_polygon(vertices);
+    vector_t vertices[] = {{-1, -1}, {+1, -1}, {+1, +1}, {-1, +1}};
+    shape_t* shape = shape_init_polygon(vertices, 4);
     return shape;
 }
 
@@ -91,18 +74,8 @@ void test_energy_conservation() {
 
 body_t *make_triangle_body() 
 {
-    list_t *vertices = list_init(3, free);
-    vector_t *v1 = malloc(sizeof(*v1));
-    *v1 = (vector_t) {1, 0};
-    list_add(vertices, v1);
-    vector_t *v2 = malloc(sizeof(*v2));
-    *v2 = (vector_t) {-0.5, +sqrt(3) / 2};
-    list_add(vertices, v2);
-    vector_t *v3 = malloc(sizeof(*v3));
-    *v3 = (vector_t) {-0.5, -sqrt(3) / 2};
-    list_add(vertices, v3);
-
-    shape_t* shape = shape_init_polygon(vertices);
+    vector_t vertices[] = {{1, 0}, {-0.5, +sqrt(3) / 2}, {-0.5, -sqrt(3) / 2}};
+    shape_t* shape = shape_init_polygon(vertices, 3);
     return body_init(shape, 1, (rgb_color_t) {0, 0, 0});
 }
 
@@ -365,6 +365,76 @@ void test_remove_anywhere() {
 }
 
 
+void test_swap_remove_compact() {
+    const size_t size = 6;
+    list_t *l = list_init(size, (free_func_t) free);
+
+    // Fill list vectors {0,0} to {5,5}
+    for (size_t i = 0; i < size; i++) {
+        vector_t *list_v = malloc(sizeof(*list_v));
+        *list_v = (vector_t) {i, i};
+        list_add(l, list_v);
+    }
+    // The last element takes the place of the removed one
+    vector_t *list_v = list_swap_remove(l, 1);
+    assert(vec_equal(*list_v, (vector_t) {1, 1}));
+    free(list_v);
+    assert(list_size(l) == 5);
+    assert(vec_equal(*(vector_t *) list_get(l, 1), (vector_t) {5, 5}));
+
+    // Holes are dropped by list_compact, keeping the order of the rest
+    list_v = list_get(l, 0);
+    list_set(l, 0, NULL);
+    free(list_v);
+    list_v = list_get(l, 3);
+    list_set(l, 3, NULL);
+    free(list_v);
+    list_compact(l);
+    assert(list_size(l) == 3);
+    assert(vec_equal(*(vector_t *) list_get(l, 0), (vector_t) {5, 5}));
+    assert(vec_equal(*(vector_t *) list_get(l, 1), (vector_t) {2, 2}));
+    assert(vec_equal(*(vector_t *) list_get(l, 2), (vector_t) {4, 4}));
+
+    list_free(l);
+}
+
+
+bool is_odd(void *v) {
+    return (size_t) ((vector_t *) v) -> x % 2 == 1;
+}
+void test_remove_if() {
+    const size_t size = 7;
+    list_t *l = list_init(size, (free_func_t) free);
+    list_t *removed = list_init(size, NULL);
+
+    // Fill list vectors {0,0} to {6,6}
+    for (size_t i = 0; i < size; i++) {
+        vector_t *list_v = malloc(sizeof(*list_v));
+        *list_v = (vector_t) {i, i};
+        list_add(l, list_v);
+    }
+    // Odd vectors are moved to removed, the rest keep their order
+    assert(list_remove_if(l, is_odd, removed) == 3);
+    assert(list_size(l) == 4 && list_size(removed) == 3);
+    for (size_t i = 0; i < 4; i++) {
+        assert(vec_equal(*(vector_t *) list_get(l, i), (vector_t) {2 * i, 2 * i}));
+    }
+    for (size_t i = 0; i < 3; i++) {
+        assert(vec_equal(*(vector_t *) list_get(removed, i), (vector_t) {2 * i + 1, 2 * i + 1}));
+        free(list_get(removed, i));
+    }
+    // Without a removed list, the list's freer is used
+    vector_t *list_v = malloc(sizeof(*list_v));
+    *list_v = (vector_t) {7, 7};
+    list_add(l, list_v);
+    assert(list_remove_if(l, is_odd, NULL) == 1);
+    assert(list_size(l) == 4);
+
+    list_free(removed);
+    list_free(l);
+}
+
+
 void add_null(void *l) {
     list_add(l, NULL);
 }
@@ -395,6 +465,8 @@ int main(int argc, char *argv[]) {
     DO_TEST(test_remove_front)
     DO_TEST(test_null_values)
     DO_TEST(test_remove_anywhere)
+    DO_TEST(test_swap_remove_compact)
+    DO_TEST(test_remove_if)
 
 
     puts("list_test PASS");
@@ -7,25 +7,8 @@
 // Make square at (+/-1, +/-1)
 shape_t *make_square() 
 {
-    list_t* vertices = list_init(4, free);
-
-    vector_t *v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, +1};
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, +1};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, -1};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {+1, -1};
-    list_add(vertices, v);
-    
-    shape_t *sq = shape_init_polygon(vertices);
+    vector_t vertices[] = {{+1, +1}, {-1, +1}, {-1, -1}, {+1, -1}};
+    shape_t *sq = shape_init_polygon(vertices, 4);
     return sq;
 }
 
@@ -46,17 +29,17 @@ void test_square_translate()
     shape_t *sq = make_square();
     shape_translate(sq, (vector_t) {2, 3});
 
-    list_t* vertices = shape_vertices(sq);
+    vector_t* vertices = shape_vertices(sq);
 
-    vector_t* v0 = list_get(vertices, 0);
-    vector_t* v1 = list_get(vertices, 1);
-    vector_t* v2 = list_get(vertices, 2);
-    vector_t* v3 = list_get(vertices, 3);
+    vector_t v0 = vertices[0];
+    vector_t v1 = vertices[1];
+    vector_t v2 = vertices[2];
+    vector_t v3 = vertices[3];
 
-    assert(vec_equal(*v0, (vector_t) {3, 4}));
-    assert(vec_equal(*v1, (vector_t) {1, 4}));
-    assert(vec_equal(*v2, (vector_t) {1, 2}));
-    assert(vec_equal(*v3, (vector_t) {3, 2}));
+    assert(vec_equal(v0, (vector_t) {3, 4}));
+    assert(vec_equal(v1, (vector_t) {1, 4}));
+    assert(vec_equal(v2, (vector_t) {1, 2}));
+    assert(vec_equal(v3, (vector_t) {3, 2}));
 
     assert(isclose(shape_area(sq), 4));
     assert(vec_isclose(shape_centroid(sq), (vector_t) {2, 3}));
@@ -69,17 +52,17 @@ void test_square_rotate() {
     shape_t *sq = make_square();
     shape_rotate(sq, 0.25 * M_PI, VEC_ZERO);
 
-    list_t* vertices = shape_vertices(sq);
+    vector_t* vertices = shape_vertices(sq);
     
-    vector_t* v0 = list_get(vertices, 0);
-    vector_t* v1 = list_get(vertices, 1);
-    vector_t* v2 = list_get(vertices, 2);
-    vector_t* v3 = list_get(vertices, 3);
+    vector_t v0 = vertices[0];
+    vector_t v1 = vertices[1];
+    vector_t v2 = vertices[2];
+    vector_t v3 = vertices[3];
 
-    assert(vec_isclose(*v0, (vector_t) {0, sqrt(2)}));
-    assert(vec_isclose(*v1, (vector_t) {-sqrt(2), 0}));
-    assert(vec_isclose(*v2, (vector_t) {0, -sqrt(2)}));
-    assert(vec_isclose(*v3, (vector_t) {sqrt(2), 0}));
+    assert(vec_isclose(v0, (vector_t) {0, sqrt(2)}));
+    assert(vec_isclose(v1, (vector_t) {-sqrt(2), 0}));
+    assert(vec_isclose(v2, (vector_t) {0, -sqrt(2)}));
+    assert(vec_isclose(v3, (vector_t) {sqrt(2), 0}));
 
     assert(isclose(shape_area(sq), 4));
     assert(vec_isclose(shape_centroid(sq), VEC_ZERO));
@@ -91,21 +74,8 @@ void test_square_rotate() {
 // Make 3-4-5 triangle
 shape_t *make_triangle() 
 {
-    list_t* vertices = list_init(3, (free_func_t) free);
-
-    vector_t *v = malloc(sizeof(*v));
-    *v = VEC_ZERO;
-    list_add(vertices, v);
-
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {4, 0};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {4, 3};
-    list_add(vertices, v);
-
-    shape_t* tri = shape_init_polygon(vertices);
+    vector_t vertices[] = {{0, 0}, {4, 0}, {4, 3}};
+    shape_t* tri = shape_init_polygon(vertices, 3);
     return tri;
 }
 
@@ -125,15 +95,15 @@ void test_triangle_translate()
     shape_t *tri = make_triangle();
     shape_translate(tri, (vector_t) {-4, -3});
     
-    list_t* vertices = shape_vertices(tri);
+    vector_t* vertices = shape_vertices(tri);
 
-    vector_t* v0 = list_get(vertices, 0);
-    vector_t* v1 = list_get(vertices, 1);
-    vector_t* v2 = list_get(vertices, 2);
+    vector_t v0 = vertices[0];
+    vector_t v1 = vertices[1];
+    vector_t v2 = vertices[2];
 
-    assert(vec_equal(*v0, (vector_t) {-4, -3}));
-    assert(vec_equal(*v1, (vector_t) {0,  -3}));
-    assert(vec_equal(*v2, (vector_t) {0,  0}));
+    assert(vec_equal(v0, (vector_t) {-4, -3}));
+    assert(vec_equal(v1, (vector_t) {0,  -3}));
+    assert(vec_equal(v2, (vector_t) {0,  0}));
 
     assert(isclose(shape_area(tri), 6));
     assert(vec_isclose(shape_centroid(tri), (vector_t) {-4.0 / 3.0, -2}));
@@ -147,15 +117,15 @@ void test_triangle_rotate() {
     // Rotate -acos(4/5) degrees around (4,3)
     shape_rotate(tri, -acos(4.0 / 5.0), (vector_t) {4, 3});
 
-    list_t* vertices = shape_vertices(tri);
+    vector_t* vertices = shape_vertices(tri);
 
-    vector_t* v0 = list_get(vertices, 0);
-    vector_t* v1 = list_get(vertices, 1);
-    vector_t* v2 = list_get(vertices, 2);
+    vector_t v0 = vertices[0];
+    vector_t v1 = vertices[1];
+    vector_t v2 = vertices[2];
 
-    assert(vec_isclose(*v0, (vector_t) {-1,  3}));
-    assert(vec_isclose(*v1, (vector_t) {2.2, 0.6}));
-    assert(vec_isclose(*v2, (vector_t) {4,   3}));
+    assert(vec_isclose(v0, (vector_t) {-1,  3}));
+    assert(vec_isclose(v1, (vector_t) {2.2, 0.6}));
+    assert(vec_isclose(v2, (vector_t) {4,   3}));
 
     assert(isclose(shape_area(tri), 6));
     assert(vec_isclose(shape_centroid(tri), (vector_t) {26.0 / 15.0, 2.2}));
@@ -169,16 +139,15 @@ void test_triangle_rotate() {
 // Circle with many points (stress test)
 shape_t *make_big_circ() 
 {
-    list_t* vertices = list_init(CIRC_NPOINTS, free);
+    vector_t* vertices = malloc(CIRC_NPOINTS * sizeof(vector_t));
 
     for (size_t i = 0; i < CIRC_NPOINTS; i++) {
         double angle = 2 * M_PI * i / CIRC_NPOINTS;
-        vector_t *v = malloc(sizeof(*v));
-        *v = (vector_t) {cos(angle), sin(angle)};
-        list_add(vertices, v);
+        vertices[i] = (vector_t) {cos(angle), sin(angle)};
     }
 
-    shape_t* c = shape_init_polygon(vertices);
+    shape_t* c = shape_init_polygon(vertices, CIRC_NPOINTS);
+    free(vertices);
     
     return c;
 }
@@ -201,8 +170,8 @@ void test_circ_translate()
     
     for (size_t i = 0; i < CIRC_NPOINTS; i++) {
         double angle = 2 * M_PI * i / CIRC_NPOINTS;
-        vector_t* v = list_get(shape_vertices(c), i);
-        assert(vec_isclose(*v,
+        vector_t v = shape_vertices(c)[i];
+        assert(vec_isclose(v,
           (vector_t) {100 + cos(angle), 200 + sin(angle)}));
     }
     assert(isclose(shape_area(c), CIRC_AREA));
@@ -220,9 +189,9 @@ void test_circ_rotate() {
 
     for (size_t i = 0; i < CIRC_NPOINTS; i++) {
         double angle = 2 * M_PI * i / CIRC_NPOINTS;
-        vector_t* v = list_get(shape_vertices(c), i);
+        vector_t v = shape_vertices(c)[i];
         assert(vec_isclose(
-            *v,
+            v,
             (vector_t) {cos(angle + ROT_ANGLE), sin(angle + ROT_ANGLE)}
         ));
     }
@@ -236,29 +205,8 @@ void test_circ_rotate() {
 // Weird nonconvex shape.
 shape_t *make_weird() 
 {
-    list_t* vertices = list_init(5, (free_func_t) free);
-    
-    vector_t *v = malloc(sizeof(*v));
-    *v = VEC_ZERO;
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {4, 1};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-2, 1};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-5, 5};
-    list_add(vertices, v);
-    
-    v = malloc(sizeof(*v));
-    *v = (vector_t) {-1, -8};
-    list_add(vertices, v);
-    
-    shape_t* w = shape_init_polygon(vertices);
+    vector_t vertices[] = {{0, 0}, {4, 1}, {-2, 1}, {-5, 5}, {-1, -8}};
+    shape_t* w = shape_init_polygon(vertices, 5);
     return w;
 }
 
@@ -279,19 +227,19 @@ void test_weird_translate() {
     
     shape_translate(w, (vector_t) {-10, -20});
 
-    list_t* vertices = shape_vertices(w);
+    vector_t* vertices = shape_vertices(w);
 
-    vector_t* v0 = list_get(vertices, 0);
-    vector_t* v1 = list_get(vertices, 1);
-    vector_t* v2 = list_get(vertices, 2);
-    vector_t* v3 = list_get(vertices, 3);
-    vector_t* v4 = list_get(vertices, 4);
+    vector_t v0 = vertices[0];
+    vector_t v1 = vertices[1];
+    vector_t v2 = vertices[2];
+    vector_t v3 = vertices[3];
+    vector_t v4 = vertices[4];
 
-    assert(vec_isclose(*v0, (vector_t) {-10, -20}));
-    assert(vec_isclose(*v1, (vector_t) {-6,  -19}));
-    assert(vec_isclose(*v2, (vector_t) {-12, -19}));
-    assert(vec_isclose(*v3, (vector_t) {-15, -15}));
-    assert(vec_isclose(*v4, (vector_t) {-11, -28}));
+    assert(vec_isclose(v0, (vector_t) {-10, -20}));
+    assert(vec_isclose(v1, (vector_t) {-6,  -19}));
+    assert(vec_isclose(v2, (vector_t) {-12, -19}));
+    assert(vec_isclose(v3, (vector_t) {-15, -15}));
+    assert(vec_isclose(v4, (vector_t) {-11, -28}));
 
     assert(isclose(shape_area(w), 23));
     assert(vec_isclose(shape_centroid(w), (vector_t) {-1603.0 / 138.0, -971.0 / 46.0}));
@@ -306,19 +254,19 @@ void test_weird_rotate()
     // Rotate 90 degrees around (0, 2)
     shape_rotate(w, M_PI / 2, (vector_t) {0, 2});
     
-    list_t* vertices = shape_vertices(w);
-
-    vector_t* v0 = list_get(vertices, 0);
-    vector_t* v1 = list_get(vertices, 1);
-    vector_t* v2 = list_get(vertices, 2);
-    vector_t* v3 = list_get(vertices, 3);
-    vector_t* v4 = list_get(vertices, 4);
-
-    assert(vec_isclose(*v0, (vector_t) {2,  2}));
-    assert(vec_isclose(*v1, (vector_t) {1,  6}));
-    assert(vec_isclose(*v2, (vector_t) {1,  0}));
-    assert(vec_isclose(*v3, (vector_t) {-3, -3}));
-    assert(vec_isclose(*v4, (vector_t) {10, 1}));
+    vector_t* vertices = shape_vertices(w);
+
+    vector_t v0 = vertices[0];
+    vector_t v1 = vertices[1];
+    vector_t v2 = vertices[2];
+    vector_t v3 = vertices[3];
+    vector_t v4 = vertices[4];
+
+    assert(vec_isclose(v0, (vector_t) {2,  2}));
+    assert(vec_isclose(v1, (vector_t) {1,  6}));
+    assert(vec_isclose(v2, (vector_t) {1,  0}));
+    assert(vec_isclose(v3, (vector_t) {-3, -3}));
+    assert(vec_isclose(v4, (vector_t) {10, 1}));
 
     assert(isclose(shape_area(w), 23));
     assert(vec_isclose(shape_centroid(w), (vector_t) {143.0 / 46.0, 53.0 / 138.0}));
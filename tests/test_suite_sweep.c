@@ -0,0 +1,98 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "scene.h"
+#include "initialize.h"
+#include "gameplay.h"
+#include "sprite.h"
+#include "test_util.h"
+
+
+// A long tick, as on slow hardware, so the player moves far in each one.
+const double TIMESTEP = 1.0 / 15;
+const double GRAVITY = -1050;
+const vector_t BLOCK_SIZE = {36, 36};
+
+
+// Builds a scene with the usual pair handlers and a falling player at the
+// given position.
+scene_t *make_scene(vector_t player)
+{
+    scene_t *scene = scene_init();
+    scene_set_timestep(scene, TIMESTEP);
+    arena_t *previous = mem_use_arena(scene_get_arena(scene));
+    add_pair_handlers(scene);
+    add_player(scene, player, PLAYER1);
+    gameplay_create(scene, scene_get_body(scene, PLAYER, 0), NULL, gameplay_gravity, (double*) &GRAVITY, NULL);
+    mem_use_arena(previous);
+    return scene;
+}
+
+
+void add_block(scene_t *scene, vector_t position, vector_t size)
+{
+    arena_t *previous = mem_use_arena(scene_get_arena(scene));
+    add_platform(scene, position, size, REGULAR_BLOCK, NULL);
+    mem_use_arena(previous);
+}
+
+
+void test_sweep_fall_onto_thin_platform()
+{
+    // Falls about 33 per tick onto a platform 4 thick.
+    scene_t *scene = make_scene((vector_t) {0, 300});
+    add_block(scene, (vector_t) {0, 2}, (vector_t) {200, 4});
+    body_t *player = scene_get_body(scene, PLAYER, 0);
+    body_set_velocity(player, (vector_t) {0, -500});
+
+    for (size_t i = 0; i < 30; i ++) {scene_tick(scene, TIMESTEP);}
+    extrema_t box = body_get_extrema(player);
+    assert(box.min_y > 3 && box.min_y < 5);
+    assert(body_get_contact(player).below);
+    assert(isclose(body_get_centroid(player).x, 0));
+    scene_free(scene);
+}
+
+
+void test_sweep_walk_across_blocks()
+{
+    // Two blocks side by side, the player standing on the first.
+    scene_t *scene = make_scene((vector_t) {12.5, BLOCK_SIZE.y + 14});
+    add_block(scene, (vector_t) {BLOCK_SIZE.x / 2, BLOCK_SIZE.y / 2}, BLOCK_SIZE);
+    add_block(scene, (vector_t) {3 * BLOCK_SIZE.x / 2, BLOCK_SIZE.y / 2}, BLOCK_SIZE);
+    body_t *player = scene_get_body(scene, PLAYER, 0);
+    for (size_t i = 0; i < 10; i ++) {scene_tick(scene, TIMESTEP);}
+    assert(body_get_contact(player).below);
+    vector_t start = body_get_centroid(player);
+
+    // Walks 10 per tick, over the seam between the blocks.
+    const size_t STEPS = 4;
+    for (size_t i = 0; i < STEPS; i ++)
+    {
+        body_set_velocity(player, (vector_t) {150, body_get_velocity(player).y});
+        scene_tick(scene, TIMESTEP);
+    }
+    vector_t end = body_get_centroid(player);
+    assert(body_get_extrema(player).min_x > BLOCK_SIZE.x);
+    assert(isclose(end.x - start.x, STEPS * 150 * TIMESTEP));
+    assert(fabs(end.y - start.y) < 1);
+    assert(body_get_contact(player).below);
+    scene_free(scene);
+}
+
+
+int main(int argc, char *argv[]) {
+    // Run all tests if there are no command-line arguments
+    bool all_tests = argc == 1;
+    // Read test name from file
+    char testname[100];
+    if (!all_tests) {
+        read_testname(argv[1], testname, sizeof(testname));
+    }
+
+    DO_TEST(test_sweep_fall_onto_thin_platform)
+    DO_TEST(test_sweep_walk_across_blocks)
+
+    puts("sweep_test PASS");
+}
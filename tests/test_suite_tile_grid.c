@@ -0,0 +1,197 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "tile_grid.h"
+#include "body.h"
+#include "shape.h"
+#include "list.h"
+#include "test_util.h"
+
+
+const double CELL_SIZE = 10;
+const rgb_color_t COLOR = (rgb_color_t) {0, 0, 0};
+
+
+// Makes a static box from its bottom-left to its top-right corner.
+body_t *make_block(vector_t v1, vector_t v2)
+{
+    body_t *body = body_init(shape_init_rectangle(v1, v2), INFINITY, COLOR);
+    body_set_kind(body, BODY_STATIC);
+    return body;
+}
+
+
+// Counts how many times a body is listed in found.
+size_t count(list_t *found, body_t *body)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < list_size(found); i ++)
+    {
+        if (list_get(found, i) == body) {n ++;}
+    }
+    return n;
+}
+
+
+void test_tile_grid_spanning_body()
+{
+    tile_grid_t *grid = tile_grid_init(CELL_SIZE);
+    list_t *found = list_init(1, NULL);
+    // Covers 5 by 3 cells.
+    body_t *wide = make_block((vector_t) {1, 1}, (vector_t) {49, 29});
+    body_t *small = make_block((vector_t) {61, 1}, (vector_t) {69, 9});
+    tile_grid_add(grid, wide);
+    tile_grid_add(grid, small);
+    assert(tile_grid_size(grid) == 2);
+
+    tile_grid_query(grid, (extrema_t) {0, 100, 0, 100}, found);
+    assert(list_size(found) == 2);
+    assert(count(found, wide) == 1);
+    assert(count(found, small) == 1);
+
+    // A box inside the body, away from its first cell.
+    tile_grid_query(grid, (extrema_t) {25, 45, 15, 25}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, wide) == 1);
+
+    // Boxes covering cells the body is filed under, but not the body itself.
+    tile_grid_query(grid, (extrema_t) {50, 55, 0, 30}, found);
+    assert(list_size(found) == 0);
+    tile_grid_query(grid, (extrema_t) {62, 68, 2, 8}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, small) == 1);
+
+    list_free(found);
+    tile_grid_free(grid);
+    body_free(wide);
+    body_free(small);
+}
+
+
+void test_tile_grid_remove()
+{
+    tile_grid_t *grid = tile_grid_init(CELL_SIZE);
+    list_t *found = list_init(1, NULL);
+    body_t *wide = make_block((vector_t) {1, 1}, (vector_t) {49, 29});
+    body_t *other = make_block((vector_t) {11, 11}, (vector_t) {19, 19});
+    tile_grid_add(grid, wide);
+    tile_grid_add(grid, other);
+
+    tile_grid_remove(grid, wide);
+    assert(tile_grid_size(grid) == 1);
+    // No cell the body covered still lists it.
+    for (double x = 5; x < 50; x += CELL_SIZE)
+    {
+        for (double y = 5; y < 30; y += CELL_SIZE)
+        {
+            tile_grid_query(grid, (extrema_t) {x, x + 1, y, y + 1}, found);
+            assert(count(found, wide) == 0);
+        }
+    }
+    tile_grid_query(grid, (extrema_t) {0, 100, 0, 100}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, other) == 1);
+
+    // Removing a body that is not in the grid does nothing.
+    tile_grid_remove(grid, wide);
+    assert(tile_grid_size(grid) == 1);
+    tile_grid_remove(grid, other);
+    assert(tile_grid_size(grid) == 0);
+    tile_grid_query(grid, (extrema_t) {0, 100, 0, 100}, found);
+    assert(list_size(found) == 0);
+
+    list_free(found);
+    tile_grid_free(grid);
+    body_free(wide);
+    body_free(other);
+}
+
+
+void test_tile_grid_growth()
+{
+    // Far more cells than the grid starts with, so the cell map is resized
+    // several times.
+    const size_t num_blocks = 500;
+    tile_grid_t *grid = tile_grid_init(CELL_SIZE);
+    list_t *found = list_init(1, NULL);
+    list_t *blocks = list_init(num_blocks, (free_func_t) body_free);
+    for (size_t i = 0; i < num_blocks; i ++)
+    {
+        double x = (i % 25) * 2 * CELL_SIZE;
+        double y = (i / 25) * 2 * CELL_SIZE;
+        body_t *block = make_block((vector_t) {x + 1, y + 1}, (vector_t) {x + 9, y + 9});
+        tile_grid_add(grid, block);
+        list_add(blocks, block);
+    }
+    assert(tile_grid_size(grid) == num_blocks);
+
+    for (size_t i = 0; i < num_blocks; i ++)
+    {
+        double x = (i % 25) * 2 * CELL_SIZE;
+        double y = (i / 25) * 2 * CELL_SIZE;
+        tile_grid_query(grid, (extrema_t) {x, x + 10, y, y + 10}, found);
+        assert(list_size(found) == 1);
+        assert(list_get(found, 0) == list_get(blocks, i));
+    }
+    tile_grid_query(grid, (extrema_t) {-1, 1000, -1, 1000}, found);
+    assert(list_size(found) == num_blocks);
+
+    list_free(found);
+    tile_grid_free(grid);
+    list_free(blocks);
+}
+
+
+void test_tile_grid_negative()
+{
+    tile_grid_t *grid = tile_grid_init(CELL_SIZE);
+    list_t *found = list_init(1, NULL);
+    body_t *left = make_block((vector_t) {-25, -25}, (vector_t) {-15, -5});
+    // Straddles the origin, so it covers cells -1 and 0 on both axes.
+    body_t *middle = make_block((vector_t) {-5, -5}, (vector_t) {5, 5});
+    tile_grid_add(grid, left);
+    tile_grid_add(grid, middle);
+
+    tile_grid_query(grid, (extrema_t) {-24, -16, -24, -16}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, left) == 1);
+    tile_grid_query(grid, (extrema_t) {-4, -3, -4, -3}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, middle) == 1);
+    tile_grid_query(grid, (extrema_t) {3, 4, 3, 4}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, middle) == 1);
+    tile_grid_query(grid, (extrema_t) {-30, 30, -30, 30}, found);
+    assert(list_size(found) == 2);
+    assert(count(found, left) == 1);
+    assert(count(found, middle) == 1);
+
+    tile_grid_remove(grid, middle);
+    tile_grid_query(grid, (extrema_t) {-30, 30, -30, 30}, found);
+    assert(list_size(found) == 1);
+    assert(count(found, left) == 1);
+
+    list_free(found);
+    tile_grid_free(grid);
+    body_free(left);
+    body_free(middle);
+}
+
+
+int main(int argc, char *argv[]) {
+    // Run all tests if there are no command-line arguments
+    bool all_tests = argc == 1;
+    // Read test name from file
+    char testname[100];
+    if (!all_tests) {
+        read_testname(argv[1], testname, sizeof(testname));
+    }
+
+    DO_TEST(test_tile_grid_spanning_body)
+    DO_TEST(test_tile_grid_remove)
+    DO_TEST(test_tile_grid_growth)
+    DO_TEST(test_tile_grid_negative)
+
+    puts("tile_grid_test PASS");
+}